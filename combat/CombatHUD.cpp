@@ -1,5 +1,7 @@
 #include "CombatHUD.h"
 #include "../utils/constants.h"
+#include "../item/item_catalog.h"
+#include <stdio.h>
 
 CombatHUD::CombatHUD(Display* disp) {
     display = disp;
@@ -26,6 +28,28 @@ void CombatHUD::clearSpriteArea() {
     display->fillRect(0, 0, Display::WIDTH, SPRITE_AREA_HEIGHT, TFT_BLACK);
 }
 
+void CombatHUD::drawLootLine(const LootDrop& loot, int y) {
+    char text[TEXT_BUFFER_SIZE];
+    if (loot.quantity > 1) {
+        snprintf(text, sizeof(text), "Got %dx %s", loot.quantity, ItemCatalog::getName(loot.itemID));
+    } else {
+        snprintf(text, sizeof(text), "Got %s", ItemCatalog::getName(loot.itemID));
+    }
+    display->drawText(text, 10, y, TFT_GREEN);
+}
+
+void CombatHUD::drawExperienceLine(int xpGained, int levelReached, int y) {
+    if (xpGained <= 0) return;
+    char text[TEXT_BUFFER_SIZE];
+    if (levelReached > 0) {
+        snprintf(text, sizeof(text), "+%d XP  LEVEL %d!", xpGained, levelReached);
+        display->drawText(text, 10, y, TFT_MAGENTA);
+    } else {
+        snprintf(text, sizeof(text), "+%d XP", xpGained);
+        display->drawText(text, 10, y, TFT_CYAN);
+    }
+}
+
 void CombatHUD::clearCombatArea() {
     display->fillRect(0, 0, Display::WIDTH, 240, TFT_BLACK);
 }
@@ -33,69 +57,77 @@ void CombatHUD::clearCombatArea() {
 void CombatHUD::drawPlayerInfo(Player* player) {
     int y = INFO_START_Y;
     
-    // Player name in green
-    display->drawText("HERO", PLAYER_INFO_X, y, TFT_GREEN);
+    char text[TEXT_BUFFER_SIZE];
+    
+    // Player name and level in green
+    snprintf(text, sizeof(text), "HERO Lv%d", player->getLevel());
+    display->drawText(text, PLAYER_INFO_X, y, TFT_GREEN);
     y += LINE_HEIGHT;
     
     // Health with color coding
-    String hpText = "HP: " + String(player->getCurrentHP()) + "/" + String(player->getMaxHP());
+    snprintf(text, sizeof(text), "HP: %d/%d", player->getCurrentHP(), player->getMaxHP());
     uint16_t hpColor = (player->getCurrentHP() < player->getMaxHP() / 3) ? TFT_RED : TFT_WHITE;
-    display->drawText(hpText.c_str(), PLAYER_INFO_X, y, hpColor);
+    display->drawText(text, PLAYER_INFO_X, y, hpColor);
     y += LINE_HEIGHT;
     
     // Attack stat
-    display->drawText(("ATK: " + String(player->getAttack())).c_str(), 
-                     PLAYER_INFO_X, y, TFT_WHITE);
+    snprintf(text, sizeof(text), "ATK: %d", player->getAttack());
+    display->drawText(text, PLAYER_INFO_X, y, TFT_WHITE);
     y += LINE_HEIGHT;
     
     // Defense stat (show total defense including temporary)
-    String defText = "DEF: " + String(player->getTotalDefense());
+    snprintf(text, sizeof(text), "DEF: %d", player->getTotalDefense());
     uint16_t defColor = player->getIsDefending() ? TFT_BLUE : TFT_WHITE;
-    display->drawText(defText.c_str(), PLAYER_INFO_X, y, defColor);
+    display->drawText(text, PLAYER_INFO_X, y, defColor);
 }
 
 void CombatHUD::drawEnemyInfo(Enemy* enemy) {
     int y = INFO_START_Y;
     
+    char text[TEXT_BUFFER_SIZE];
+    
     // Enemy name in red
-    display->drawText(enemy->getName().c_str(), ENEMY_INFO_X, y, TFT_RED);
+    display->drawText(enemy->getName(), ENEMY_INFO_X, y, TFT_RED);
     y += LINE_HEIGHT;
     
     // Health with color coding
-    String hpText = "HP: " + String(enemy->getCurrentHP()) + "/" + String(enemy->getMaxHP());
+    snprintf(text, sizeof(text), "HP: %d/%d", enemy->getCurrentHP(), enemy->getMaxHP());
     uint16_t hpColor = (enemy->getCurrentHP() < enemy->getMaxHP() / 3) ? TFT_RED : TFT_WHITE;
-    display->drawText(hpText.c_str(), ENEMY_INFO_X, y, hpColor);
+    display->drawText(text, ENEMY_INFO_X, y, hpColor);
     y += LINE_HEIGHT;
     
     // Attack stat
-    display->drawText(("ATK: " + String(enemy->getAttack())).c_str(), 
-                     ENEMY_INFO_X, y, TFT_WHITE);
+    snprintf(text, sizeof(text), "ATK: %d", enemy->getAttack());
+    display->drawText(text, ENEMY_INFO_X, y, TFT_WHITE);
     y += LINE_HEIGHT;
     
     // Defense stat (show total defense including temporary)
-    String defText = "DEF: " + String(enemy->getTotalDefense());
+    snprintf(text, sizeof(text), "DEF: %d", enemy->getTotalDefense());
     uint16_t defColor = enemy->getIsDefending() ? TFT_BLUE : TFT_WHITE;
-    display->drawText(defText.c_str(), ENEMY_INFO_X, y, defColor);
+    display->drawText(text, ENEMY_INFO_X, y, defColor);
 }
 
 void CombatHUD::drawTurnInfo(int turnCounter) {
     // Turn counter in yellow
-    display->drawText(("Turn: " + String(turnCounter)).c_str(), 
-                     PLAYER_INFO_X, 100, TFT_YELLOW);
+    char text[TEXT_BUFFER_SIZE];
+    snprintf(text, sizeof(text), "Turn: %d", turnCounter);
+    display->drawText(text, PLAYER_INFO_X, 100, TFT_YELLOW);
 }
 
 void CombatHUD::drawInventoryInfo(Player* player) {
+    char text[TEXT_BUFFER_SIZE];
+    
     // Show potions in cyan
-    String potionText = "Potions: " + String(player->getHealthPotions());
+    snprintf(text, sizeof(text), "Potions: %d", player->getHealthPotions());
     uint16_t potionColor = (player->getHealthPotions() == 0) ? TFT_RED : TFT_CYAN;
-    display->drawText(potionText.c_str(), PLAYER_INFO_X, 120, potionColor);
+    display->drawText(text, PLAYER_INFO_X, 120, potionColor);
     
     // Show gold (for future shop integration)
-    display->drawText(("Gold: " + String(player->getGold())).c_str(), 
-                     PLAYER_INFO_X, 135, TFT_YELLOW);
+    snprintf(text, sizeof(text), "Gold: %d", player->getGold());
+    display->drawText(text, PLAYER_INFO_X, 135, TFT_YELLOW);
 }
 
-void CombatHUD::drawVictoryScreen() {
+void CombatHUD::drawVictoryScreen(const LootDrop& loot, int goldGained, int xpGained, int levelReached) {
     clearCombatArea();
     
     // Large victory text
@@ -103,14 +135,25 @@ void CombatHUD::drawVictoryScreen() {
     
     // Show that progress continues
     display->drawText("Enemy defeated!", 20, 100, TFT_WHITE);
-    display->drawText("Progress saved", 25, 115, TFT_CYAN);
+    if (goldGained > 0) {
+        char text[TEXT_BUFFER_SIZE];
+        snprintf(text, sizeof(text), "+%d gold", goldGained);
+        display->drawText(text, 25, 115, TFT_YELLOW);
+    } else {
+        display->drawText("Progress saved", 25, 115, TFT_CYAN);
+    }
     
     // Instructions
     display->drawText("Press any button", 10, 140, TFT_YELLOW);
     display->drawText("to continue", 35, 155, TFT_YELLOW);
     
-    // Optional: Add victory effects or stats here later
-    display->drawText("Onward!", 60, 180, TFT_GREEN);
+    // Drop from the enemy, if any
+    if (loot.itemID != ITEM_ID_NONE) {
+        drawLootLine(loot, 180);
+    } else {
+        display->drawText("Onward!", 60, 180, TFT_GREEN);
+    }
+    drawExperienceLine(xpGained, levelReached, 200);
 }
 
 void CombatHUD::drawDefeatScreen() {
@@ -131,6 +174,44 @@ void CombatHUD::drawDefeatScreen() {
     display->drawText("to return to town", 10, 195, TFT_CYAN);
 }
 
+void CombatHUD::drawAutoResolveSummary(const AutoResolveSummary& summary, int goldGained, const LootDrop& loot,
+                                       int xpGained, int levelReached) {
+    clearCombatArea();
+    
+    // Outcome
+    if (summary.result == RESULT_VICTORY) {
+        display->drawText("VICTORY!", 40, 60, TFT_GREEN, 2);
+    } else {
+        display->drawText("DEFEAT!", 50, 60, TFT_RED, 2);
+    }
+    display->drawText("Auto-battle", 35, 85, TFT_CYAN);
+    
+    // Fight stats
+    char text[TEXT_BUFFER_SIZE];
+    snprintf(text, sizeof(text), "Turns: %d", summary.turns);
+    display->drawText(text, 10, 105, TFT_WHITE);
+    snprintf(text, sizeof(text), "Damage taken: %d", summary.damageTaken);
+    display->drawText(text, 10, 120, TFT_WHITE);
+    snprintf(text, sizeof(text), "Potions used: %d", summary.potionsUsed);
+    display->drawText(text, 10, 135, TFT_WHITE);
+    
+    // Loot
+    if (goldGained > 0) {
+        snprintf(text, sizeof(text), "Loot: %d gold", goldGained);
+    } else {
+        snprintf(text, sizeof(text), "Loot: none");
+    }
+    display->drawText(text, 10, 150, TFT_YELLOW);
+    if (loot.itemID != ITEM_ID_NONE) {
+        drawLootLine(loot, 165);
+    }
+    
+    // Instructions
+    display->drawText("Press any button", 10, 180, TFT_YELLOW);
+    display->drawText("to continue", 35, 195, TFT_YELLOW);
+    drawExperienceLine(xpGained, levelReached, 215);
+}
+
 void CombatHUD::drawNewCombatPrompt() {
     clearCombatArea();
     
@@ -5,6 +5,7 @@
 #include "../entities/player.h"
 #include "../entities/enemy.h"
 #include "../combat/combat_manager.h"
+#include "../item/loot_tables.h"
 
 class CombatHUD {
 private:
@@ -16,6 +17,7 @@ private:
     static const int ENEMY_INFO_X = 100;
     static const int INFO_START_Y = 20;
     static const int LINE_HEIGHT = 15;
+    static const int TEXT_BUFFER_SIZE = 32;  // Stack buffer for formatted lines (no String)
     
     // Drawing helper methods
     void drawPlayerInfo(Player* player);
@@ -23,6 +25,8 @@ private:
     void drawTurnInfo(int turnCounter);
     void drawInventoryInfo(Player* player);
     void clearSpriteArea();
+    void drawLootLine(const LootDrop& loot, int y);
+    void drawExperienceLine(int xpGained, int levelReached, int y);
     
 public:
     CombatHUD(Display* disp);
@@ -32,9 +36,12 @@ public:
     void updateCombatStats(Player* player, Enemy* enemy, int turnCounter);
     
     // Result screens
-    void drawVictoryScreen();
+    // levelReached is the new level after a level-up, 0 if none
+    void drawVictoryScreen(const LootDrop& loot, int goldGained, int xpGained = 0, int levelReached = 0);
     void drawDefeatScreen();
     void drawNewCombatPrompt();
+    void drawAutoResolveSummary(const AutoResolveSummary& summary, int goldGained, const LootDrop& loot,
+                                int xpGained = 0, int levelReached = 0);
     
     // Utility
     void clearCombatArea();
@@ -0,0 +1,279 @@
+#include "combat_lanes.h"
+#include "combat_rules.h"
+#include "../utils/constants.h"
+
+#if defined(__GNUC__) && !defined(ARDUINO)
+#define COMBAT_LANES_SIMD 1
+#endif
+
+PlayerAction CombatLanes::choosePolicyAction(const CombatSnapshot& fight, const LanePolicy& policy) {
+    if (fight.healthPotions > 0 && fight.player.currentHP <= policy.potionThresholdHP) {
+        return ACTION_USE_ITEM;
+    }
+    return ACTION_ATTACK;
+}
+
+CombatResult CombatLanes::runScalar(CombatSnapshot& fight, const LanePolicy& policy) {
+    while (fight.combatState == COMBAT_CHOOSE_ACTIONS && fight.turnCounter < COMBAT_LANES_MAX_TURNS) {
+        CombatRules::stepTurn(fight, choosePolicyAction(fight, policy));
+    }
+    return CombatRules::getResult(fight);
+}
+
+bool CombatLanes::isVectorized() {
+#ifdef COMBAT_LANES_SIMD
+    return true;
+#else
+    return false;
+#endif
+}
+
+#ifdef COMBAT_LANES_SIMD
+
+// ==============================================
+// VECTOR KERNEL (host only)
+// ==============================================
+
+typedef int32_t LaneInt __attribute__((vector_size(COMBAT_LANES * sizeof(int32_t))));
+typedef uint32_t LaneUInt __attribute__((vector_size(COMBAT_LANES * sizeof(uint32_t))));
+
+// Struct-of-arrays view of COMBAT_LANES fights
+struct LaneState {
+    LaneInt playerHP, playerMaxHP, playerAttack, playerDefense, playerSpeed, playerTemp, playerDefending;
+    LaneInt enemyHP, enemyDefense, enemySpeed, enemyTemp, enemyDefending;
+    LaneInt enemyDamage;      // Attack after the AI multiplier (constant for the fight)
+    LaneInt attackChance;     // Percent chance the enemy attacks
+    LaneInt potions, turn, state;
+    LaneUInt rng0, rng1, rng2, rng3;
+};
+
+// Vector values never leave this file, so the AVX ABI warning on returning
+// them doesn't matter. That pragma can't silence the matching note for
+// by-value arguments, so vectors are passed by const reference.
+#pragma GCC diagnostic ignored "-Wpsabi"
+
+static inline LaneInt splat(int32_t value) {
+    LaneInt v;
+    for (int l = 0; l < COMBAT_LANES; l++) {
+        v[l] = value;
+    }
+    return v;
+}
+
+static inline LaneInt select(const LaneInt& mask, const LaneInt& a, const LaneInt& b) {
+    return (a & mask) | (b & ~mask);
+}
+
+static inline LaneUInt selectU(const LaneInt& mask, const LaneUInt& a, const LaneUInt& b) {
+    LaneUInt m = (LaneUInt)mask;
+    return (a & m) | (b & ~m);
+}
+
+static inline LaneInt laneMax(const LaneInt& a, const LaneInt& b) {
+    return select(a > b, a, b);
+}
+
+static inline LaneInt laneMin(const LaneInt& a, const LaneInt& b) {
+    return select(a < b, a, b);
+}
+
+static inline bool anyLane(const LaneInt& mask) {
+    for (int l = 0; l < COMBAT_LANES; l++) {
+        if (mask[l]) return true;
+    }
+    return false;
+}
+
+static inline LaneUInt rotl(const LaneUInt& x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+static void loadLanes(LaneState& v, const CombatSnapshot* fights, int count) {
+    memset(&v, 0, sizeof(v));
+    
+    for (int l = 0; l < COMBAT_LANES; l++) {
+        if (l >= count) {
+            // Padding lane: marked finished so it is never touched
+            v.state[l] = COMBAT_PLAYER_WIN;
+            continue;
+        }
+        
+        const CombatSnapshot& f = fights[l];
+        v.playerHP[l] = f.player.currentHP;
+        v.playerMaxHP[l] = f.player.maxHP;
+        v.playerAttack[l] = f.player.attack;
+        v.playerDefense[l] = f.player.defense;
+        v.playerSpeed[l] = f.player.speed;
+        v.playerTemp[l] = f.player.temporaryDefense;
+        v.playerDefending[l] = f.player.isDefending;
+        v.enemyHP[l] = f.enemy.currentHP;
+        v.enemyDefense[l] = f.enemy.defense;
+        v.enemySpeed[l] = f.enemy.speed;
+        v.enemyTemp[l] = f.enemy.temporaryDefense;
+        v.enemyDefending[l] = f.enemy.isDefending;
+        v.enemyDamage[l] = CombatRules::calculateEnemyAttackDamage(f.enemy.attack, (AIType)f.enemy.aiType);
+        v.attackChance[l] = CombatRules::getEnemyAttackChance((AIType)f.enemy.aiType);
+        v.potions[l] = f.healthPotions;
+        v.turn[l] = f.turnCounter;
+        v.state[l] = f.combatState;
+        v.rng0[l] = f.rngState[0];
+        v.rng1[l] = f.rngState[1];
+        v.rng2[l] = f.rngState[2];
+        v.rng3[l] = f.rngState[3];
+    }
+}
+
+static void storeLanes(const LaneState& v, CombatSnapshot* fights, int count) {
+    for (int l = 0; l < count; l++) {
+        CombatSnapshot& f = fights[l];
+        f.player.currentHP = (int16_t)v.playerHP[l];
+        f.player.temporaryDefense = (int16_t)v.playerTemp[l];
+        f.player.isDefending = (uint8_t)v.playerDefending[l];
+        f.enemy.currentHP = (int16_t)v.enemyHP[l];
+        f.enemy.temporaryDefense = (int16_t)v.enemyTemp[l];
+        f.enemy.isDefending = (uint8_t)v.enemyDefending[l];
+        f.healthPotions = (uint8_t)v.potions[l];
+        f.turnCounter = (uint16_t)v.turn[l];
+        f.combatState = (uint8_t)v.state[l];
+        f.rngState[0] = v.rng0[l];
+        f.rngState[1] = v.rng1[l];
+        f.rngState[2] = v.rng2[l];
+        f.rngState[3] = v.rng3[l];
+    }
+}
+
+// xoshiro128** step in every lane where mask is set
+static LaneUInt nextRandom(LaneState& v, const LaneInt& mask) {
+    LaneUInt result = rotl(v.rng1 * 5u, 7) * 9u;
+    LaneUInt t = v.rng1 << 9;
+    
+    LaneUInt s2 = v.rng2 ^ v.rng0;
+    LaneUInt s3 = v.rng3 ^ v.rng1;
+    LaneUInt s1 = v.rng1 ^ s2;
+    LaneUInt s0 = v.rng0 ^ s3;
+    s2 ^= t;
+    s3 = rotl(s3, 11);
+    
+    v.rng0 = selectU(mask, s0, v.rng0);
+    v.rng1 = selectU(mask, s1, v.rng1);
+    v.rng2 = selectU(mask, s2, v.rng2);
+    v.rng3 = selectU(mask, s3, v.rng3);
+    return result;
+}
+
+// Enemy roll 1-100, identical to Rng::range(1, 101).
+// The 64-bit product of Lemire's method is rebuilt from 16-bit halves so
+// every lane op stays 32-bit. The rare rejected draws are redone in scalar.
+static LaneInt rollPercent(LaneState& v, const LaneInt& live) {
+    LaneUInt x = nextRandom(v, live);
+    LaneUInt low = x * 100u;
+    LaneUInt high = ((x >> 16) * 100u + (((x & 0xFFFFu) * 100u) >> 16)) >> 16;
+    LaneInt roll = (LaneInt)high + 1;
+    
+    const uint32_t threshold = (0u - 100u) % 100u;
+    LaneInt rejected = live & (LaneInt)(low < threshold);
+    if (anyLane(rejected)) {
+        for (int l = 0; l < COMBAT_LANES; l++) {
+            if (!rejected[l]) continue;
+            
+            uint32_t state[4] = {v.rng0[l], v.rng1[l], v.rng2[l], v.rng3[l]};
+            Rng rng;
+            rng.setState(state);
+            uint32_t lowLane = low[l];
+            uint64_t m = 0;
+            while (lowLane < threshold) {
+                m = (uint64_t)rng.next() * 100u;
+                lowLane = (uint32_t)m;
+            }
+            roll[l] = (int32_t)(m >> 32) + 1;
+            rng.getState(state);
+            v.rng0[l] = state[0];
+            v.rng1[l] = state[1];
+            v.rng2[l] = state[2];
+            v.rng3[l] = state[3];
+        }
+    }
+    return roll;
+}
+
+// Player action in lanes where mask is set
+static void applyPlayerAction(LaneState& v, const LaneInt& mask, const LaneInt& useItem) {
+    LaneInt attack = mask & ~useItem;
+    LaneInt drink = mask & useItem;
+    
+    LaneInt damage = laneMax(v.playerAttack - (v.enemyDefense + v.enemyTemp), splat(MIN_DAMAGE));
+    v.enemyHP = select(attack, laneMax(v.enemyHP - damage, splat(0)), v.enemyHP);
+    v.enemyTemp = select(attack, splat(0), v.enemyTemp);
+    v.enemyDefending = select(attack, splat(0), v.enemyDefending);
+    v.state = select(attack & (v.enemyHP <= 0), splat(COMBAT_PLAYER_WIN), v.state);
+    
+    v.potions = select(drink, v.potions - 1, v.potions);
+    v.playerHP = select(drink, laneMin(v.playerHP + POTION_HEAL_AMOUNT, v.playerMaxHP), v.playerHP);
+}
+
+// Enemy action in lanes where mask is set
+static void applyEnemyAction(LaneState& v, const LaneInt& mask, const LaneInt& enemyAttacks) {
+    LaneInt attack = mask & enemyAttacks;
+    LaneInt defend = mask & ~enemyAttacks;
+    
+    LaneInt damage = laneMax(v.enemyDamage - (v.playerDefense + v.playerTemp), splat(MIN_DAMAGE));
+    v.playerHP = select(attack, laneMax(v.playerHP - damage, splat(0)), v.playerHP);
+    v.playerTemp = select(attack, splat(0), v.playerTemp);
+    v.playerDefending = select(attack, splat(0), v.playerDefending);
+    v.state = select(attack & (v.playerHP <= 0), splat(COMBAT_PLAYER_LOSE), v.state);
+    
+    v.enemyTemp = select(defend, v.enemyTemp + v.enemyDefense, v.enemyTemp);
+    v.enemyDefending = select(defend, splat(1), v.enemyDefending);
+}
+
+static void runLanes(LaneState& v, const LanePolicy& policy) {
+    const LaneInt ongoing = splat(COMBAT_CHOOSE_ACTIONS);
+    
+    for (;;) {
+        LaneInt live = (v.state == ongoing) & (v.turn < COMBAT_LANES_MAX_TURNS);
+        if (!anyLane(live)) break;
+        
+        // Both sides choose (same order as CombatRules::stepTurn)
+        LaneInt roll = rollPercent(v, live);
+        LaneInt enemyAttacks = roll <= v.attackChance;
+        LaneInt useItem = (v.potions > 0) & (v.playerHP <= policy.potionThresholdHP);
+        
+        // Turn order: defend (0) > item (1) > attack (2), then speed
+        LaneInt playerPriority = select(useItem, splat(1), splat(2));
+        LaneInt enemyPriority = select(enemyAttacks, splat(2), splat(0));
+        LaneInt playerFirst = (playerPriority < enemyPriority) |
+                              ((playerPriority == enemyPriority) & (v.playerSpeed >= v.enemySpeed));
+        
+        applyPlayerAction(v, live & playerFirst, useItem);
+        applyEnemyAction(v, live & ~playerFirst, enemyAttacks);
+        
+        LaneInt stillGoing = live & (v.state == ongoing);
+        applyEnemyAction(v, stillGoing & playerFirst, enemyAttacks);
+        applyPlayerAction(v, stillGoing & ~playerFirst, useItem);
+        
+        v.turn = select(live, v.turn + 1, v.turn);
+    }
+}
+
+void CombatLanes::runBatch(CombatSnapshot* fights, int count, const LanePolicy& policy) {
+    for (int base = 0; base < count; base += COMBAT_LANES) {
+        int chunk = count - base;
+        if (chunk > COMBAT_LANES) chunk = COMBAT_LANES;
+        
+        LaneState v;
+        loadLanes(v, fights + base, chunk);
+        runLanes(v, policy);
+        storeLanes(v, fights + base, chunk);
+    }
+}
+
+#else
+
+// Scalar fallback (device builds and compilers without vector extensions)
+void CombatLanes::runBatch(CombatSnapshot* fights, int count, const LanePolicy& policy) {
+    for (int i = 0; i < count; i++) {
+        runScalar(fights[i], policy);
+    }
+}
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef COMBAT_LANES_H
+#define COMBAT_LANES_H
+
+#include <stdint.h>
+#include "combat_snapshot.h"
+#include "combat_types.h"
+
+// Number of fights resolved side by side
+static const int COMBAT_LANES = 8;
+
+// Safety cap so a batch always finishes
+static const int COMBAT_LANES_MAX_TURNS = 200;
+
+// Fixed player policy for batch fights: attack, but drink a potion
+// when HP is at or below the threshold (and potions are left).
+struct LanePolicy {
+    int16_t potionThresholdHP;
+};
+
+// Potion threshold the host tools sweep with
+static const int16_t LANE_POTION_THRESHOLD_HP = 20;
+
+// Runs many independent fights to completion for balance sweeps.
+// On hosts with GCC/Clang vector extensions the fights run in SIMD lanes;
+// everywhere else each fight goes through the scalar CombatRules engine.
+// Given the same snapshots (including RNG state) both paths produce
+// bit-identical results.
+class CombatLanes {
+public:
+    // Pick the action the policy takes in this state
+    static PlayerAction choosePolicyAction(const CombatSnapshot& fight, const LanePolicy& policy);
+    
+    // Scalar reference: one fight through CombatRules::stepTurn
+    static CombatResult runScalar(CombatSnapshot& fight, const LanePolicy& policy);
+    
+    // Run all fights in place (vectorized when available)
+    static void runBatch(CombatSnapshot* fights, int count, const LanePolicy& policy);
+    
+    // True when runBatch uses the vector kernel
+    static bool isVectorized();
+};
+
+#endif
@@ -2,6 +2,28 @@
 #include "damage_calculator.h"
 #include "turn_queue.h"
 #include "../utils/constants.h"
+#include "../utils/rng.h"
+#include "combat_rules.h"
+#include "combat_lanes.h"
+
+// Snapshot helpers
+static void captureEntity(const Entity* entity, EntitySnapshot& out) {
+    out.currentHP = entity->getCurrentHP();
+    out.maxHP = entity->getMaxHP();
+    out.attack = entity->getAttack();
+    out.defense = entity->getDefense();
+    out.speed = entity->getSpeed();
+    out.temporaryDefense = entity->getTemporaryDefense();
+    out.isDefending = entity->getIsDefending() ? 1 : 0;
+    out.aiType = 0;
+}
+
+static void restoreEntityCombatState(Entity* entity, const EntitySnapshot& in) {
+    entity->setCurrentHP(in.currentHP);
+    entity->resetDefense();
+    entity->addTemporaryDefense(in.temporaryDefense);
+    entity->setDefending(in.isDefending != 0);
+}
 
 // Constructor
 CombatManager::CombatManager() {
@@ -12,6 +34,8 @@ CombatManager::CombatManager() {
     actionsChosen = false;
     playerAction = ACTION_ATTACK;
     enemyAction = ENEMY_ATTACK;
+    hasLastTurnSnapshot = false;
+    verbose = true;
 }
 
 // Start combat
@@ -21,12 +45,15 @@ void CombatManager::startCombat(Player* p, Enemy* e) {
     turnCounter = 1;
     actionsChosen = false;
     currentState = COMBAT_CHOOSE_ACTIONS;
+    hasLastTurnSnapshot = false;
     
     // Clear any existing defense states
     player->resetDefense();
     currentEnemy->resetDefense();
     
-    Serial.println("Combat begins! " + player->getName() + " vs " + currentEnemy->getName());
+    if (verbose) {
+        Serial.println(String("Combat begins! ") + player->getName() + " vs " + currentEnemy->getName());
+    }
 }
 
 // End combat and cleanup
@@ -43,6 +70,7 @@ void CombatManager::endCombat() {
     currentState = COMBAT_CHOOSE_ACTIONS;
     turnCounter = 0;
     actionsChosen = false;
+    hasLastTurnSnapshot = false;
 }
 
 // Process complete turn: choose actions + execute them
@@ -51,6 +79,10 @@ CombatResult CombatManager::processTurn(PlayerAction action) {
         return RESULT_ONGOING;
     }
     
+    // Remember where this turn started (for undo)
+    saveSnapshot(lastTurnSnapshot);
+    hasLastTurnSnapshot = true;
+    
     // Store actions
     playerAction = action;
     enemyAction = currentEnemy->chooseAction();
@@ -58,27 +90,31 @@ CombatResult CombatManager::processTurn(PlayerAction action) {
     currentState = COMBAT_EXECUTE_ACTIONS;
     
     // Show choices
-    String playerActionName = "";
-    switch(playerAction) {
-        case ACTION_ATTACK: playerActionName = "ATTACK"; break;
-        case ACTION_DEFEND: playerActionName = "DEFEND"; break;
-        case ACTION_USE_ITEM: playerActionName = "USE ITEM"; break;
+    if (verbose) {
+        String playerActionName = "";
+        switch(playerAction) {
+            case ACTION_ATTACK: playerActionName = "ATTACK"; break;
+            case ACTION_DEFEND: playerActionName = "DEFEND"; break;
+            case ACTION_USE_ITEM: playerActionName = "USE ITEM"; break;
+        }
+        
+        String enemyActionName = (enemyAction == ENEMY_ATTACK) ? "ATTACK" : "DEFEND";
+        
+        Serial.println("CHOICES:");
+        Serial.println(String("  ") + player->getName() + " chooses: " + playerActionName);
+        Serial.println(String("  ") + currentEnemy->getName() + " chooses: " + enemyActionName);
+        Serial.println();
     }
     
-    String enemyActionName = (enemyAction == ENEMY_ATTACK) ? "ATTACK" : "DEFEND";
-    
-    Serial.println("CHOICES:");
-    Serial.println("  " + player->getName() + " chooses: " + playerActionName);
-    Serial.println("  " + currentEnemy->getName() + " chooses: " + enemyActionName);
-    Serial.println();
-    
     // Create turn queue to determine order (local variable)
     TurnQueue* turnQueue = new TurnQueue(player, currentEnemy, playerAction, enemyAction);
     
     // Show execution order
-    Serial.println("EXECUTION ORDER: " + turnQueue->getTurnOrderReason());
-    Serial.println();
-    Serial.println("ACTIONS:");
+    if (verbose) {
+        Serial.println("EXECUTION ORDER: " + turnQueue->getTurnOrderReason());
+        Serial.println();
+        Serial.println("ACTIONS:");
+    }
     
     // Execute actions in order determined by TurnQueue
     bool playerGoesFirst = turnQueue->doesPlayerGoFirst();
@@ -108,6 +144,76 @@ CombatResult CombatManager::processTurn(PlayerAction action) {
     return getCombatResult();
 }
 
+// Auto-resolve the rest of the fight in one call. No per-turn logging or
+// drawing; the caller renders a single summary screen afterwards.
+CombatResult CombatManager::autoResolve(AutoResolveSummary& summary) {
+    summary.result = RESULT_ONGOING;
+    summary.turns = 0;
+    summary.damageTaken = 0;
+    summary.damageDealt = 0;
+    summary.potionsUsed = 0;
+    if (!player || !currentEnemy) return RESULT_ONGOING;
+    
+    bool wasVerbose = verbose;
+    verbose = false;
+    
+    while (currentState == COMBAT_CHOOSE_ACTIONS && summary.turns < AUTO_RESOLVE_MAX_TURNS) {
+        int hpBefore = player->getCurrentHP();
+        int enemyHPBefore = currentEnemy->getCurrentHP();
+        int potionsBefore = player->getHealthPotions();
+        
+        processTurn(chooseAutoAction());
+        summary.turns++;
+        
+        // Items always resolve before attacks, so any heal lands before the hit
+        int healed = 0;
+        if (player->getHealthPotions() < potionsBefore) {
+            summary.potionsUsed++;
+            int healedTo = hpBefore + POTION_HEAL_AMOUNT;
+            if (healedTo > player->getMaxHP()) {
+                healedTo = player->getMaxHP();
+            }
+            healed = healedTo - hpBefore;
+        }
+        summary.damageTaken += hpBefore + healed - player->getCurrentHP();
+        summary.damageDealt += enemyHPBefore - currentEnemy->getCurrentHP();
+    }
+    
+    verbose = wasVerbose;
+    summary.result = getCombatResult();
+    
+    if (verbose) {
+        Serial.println("Auto-resolved in " + String(summary.turns) + " turns, took " +
+                       String(summary.damageTaken) + " damage, used " +
+                       String(summary.potionsUsed) + " potions");
+    }
+    return summary.result;
+}
+
+// Player policy for auto-resolve: attack, and drink a potion once two enemy
+// hits could kill.
+PlayerAction CombatManager::chooseAutoAction() const {
+    CombatSnapshot snapshot;
+    saveSnapshot(snapshot);
+    
+    int enemyHit = CombatRules::calculateEnemyAttackDamage(currentEnemy->getAttack(),
+                                                          currentEnemy->getAIType());
+    enemyHit = DamageCalculator::calculateFinalDamage(enemyHit, player->getDefense());
+    
+    int threshold = enemyHit * 2;
+    if (threshold > player->getMaxHP() / 2) {
+        threshold = player->getMaxHP() / 2;
+    }
+    
+    LanePolicy policy;
+    policy.potionThresholdHP = (int16_t)threshold;
+    return CombatLanes::choosePolicyAction(snapshot, policy);
+}
+
+void CombatManager::setVerbose(bool enabled) {
+    verbose = enabled;
+}
+
 // Execute player action using DamageCalculator
 void CombatManager::executePlayerAction() {
     if (!player || !currentEnemy) return;
@@ -119,18 +225,22 @@ void CombatManager::executePlayerAction() {
                 int enemyDefense = currentEnemy->getTotalDefense();
                 int finalDamage = DamageCalculator::calculateFinalDamage(baseDamage, enemyDefense);
                 
-                Serial.print("  " + player->getName() + " attacks for " + String(baseDamage) + " damage");
-                if (enemyDefense > 0) {
-                    Serial.print(" (" + String(enemyDefense) + " blocked)");
-                    Serial.print(" = " + String(finalDamage) + " final damage");
+                if (verbose) {
+                    Serial.print(String("  ") + player->getName() + " attacks for " + String(baseDamage) + " damage");
+                    if (enemyDefense > 0) {
+                        Serial.print(" (" + String(enemyDefense) + " blocked)");
+                        Serial.print(" = " + String(finalDamage) + " final damage");
+                    }
+                    Serial.println();
                 }
-                Serial.println();
                 
                 currentEnemy->takeDamage(baseDamage);
                 
                 if (!currentEnemy->isAlive()) {
                     currentState = COMBAT_PLAYER_WIN;
-                    Serial.println("  " + currentEnemy->getName() + " is defeated!");
+                    if (verbose) {
+                        Serial.println(String("  ") + currentEnemy->getName() + " is defeated!");
+                    }
                 }
             }
             break;
@@ -139,18 +249,23 @@ void CombatManager::executePlayerAction() {
             {
                 int defenseBonus = DamageCalculator::calculatePlayerDefenseBonus(player);
                 player->performDefend(); // This adds the defense bonus
-                Serial.println("  " + player->getName() + " defends for +" + String(defenseBonus) + " defense");
+                if (verbose) {
+                    Serial.println(String("  ") + player->getName() + " defends for +" + String(defenseBonus) + " defense");
+                }
             }
             break;
             
         case ACTION_USE_ITEM:
             {
                 int oldHP = player->getCurrentHP();
-                if (player->performUseItem()) {
-                    int healed = player->getCurrentHP() - oldHP;
-                    Serial.println("  " + player->getName() + " uses health potion! (+" + String(healed) + " HP)");
-                } else {
-                    Serial.println("  " + player->getName() + " has no items to use!");
+                bool used = player->performUseItem();
+                if (verbose) {
+                    if (used) {
+                        int healed = player->getCurrentHP() - oldHP;
+                        Serial.println(String("  ") + player->getName() + " uses health potion! (+" + String(healed) + " HP)");
+                    } else {
+                        Serial.println(String("  ") + player->getName() + " has no items to use!");
+                    }
                 }
             }
             break;
@@ -166,23 +281,29 @@ void CombatManager::executeEnemyAction() {
         int playerDefense = player->getTotalDefense();
         int finalDamage = DamageCalculator::calculateFinalDamage(baseDamage, playerDefense);
         
-        Serial.print("  " + currentEnemy->getName() + " attacks for " + String(baseDamage) + " damage");
-        if (playerDefense > 0) {
-            Serial.print(" (" + String(playerDefense) + " blocked)");
-            Serial.print(" = " + String(finalDamage) + " final damage");
+        if (verbose) {
+            Serial.print(String("  ") + currentEnemy->getName() + " attacks for " + String(baseDamage) + " damage");
+            if (playerDefense > 0) {
+                Serial.print(" (" + String(playerDefense) + " blocked)");
+                Serial.print(" = " + String(finalDamage) + " final damage");
+            }
+            Serial.println();
         }
-        Serial.println();
         
         player->takeDamage(baseDamage);
         
         if (!player->isAlive()) {
             currentState = COMBAT_PLAYER_LOSE;
-            Serial.println("  " + player->getName() + " is defeated!");
+            if (verbose) {
+                Serial.println(String("  ") + player->getName() + " is defeated!");
+            }
         }
     } else {
         int defenseBonus = DamageCalculator::calculateEnemyDefenseBonus(currentEnemy);
         currentEnemy->performDefend(); // This adds the defense bonus
-        Serial.println("  " + currentEnemy->getName() + " defends for +" + String(defenseBonus) + " defense");
+        if (verbose) {
+            Serial.println(String("  ") + currentEnemy->getName() + " defends for +" + String(defenseBonus) + " defense");
+        }
     }
 }
 
@@ -202,6 +323,47 @@ CombatResult CombatManager::getCombatResult() const {
     }
 }
 
+// Snapshots
+void CombatManager::saveSnapshot(CombatSnapshot& out) const {
+    memset(&out, 0, sizeof(CombatSnapshot));
+    if (!player || !currentEnemy) return;
+    
+    captureEntity(player, out.player);
+    captureEntity(currentEnemy, out.enemy);
+    out.enemy.aiType = (uint8_t)currentEnemy->getAIType();
+    out.turnCounter = (uint16_t)turnCounter;
+    out.combatState = (uint8_t)currentState;
+    out.healthPotions = (uint8_t)player->getHealthPotions();
+    RngService::get(RNG_COMBAT).getState(out.rngState);
+}
+
+// Restores onto the fight's current Player/Enemy. Player stats come from
+// equipment and don't change mid-fight, so only the combat state is restored;
+// the enemy gets its full stat block back.
+bool CombatManager::restoreSnapshot(const CombatSnapshot& in) {
+    if (!player || !currentEnemy) return false;
+    
+    restoreEntityCombatState(player, in.player);
+    player->setHealthPotions(in.healthPotions);
+    
+    currentEnemy->setStats(in.enemy.maxHP, in.enemy.attack, in.enemy.defense, in.enemy.speed);
+    currentEnemy->setAIType((AIType)in.enemy.aiType);
+    restoreEntityCombatState(currentEnemy, in.enemy);
+    
+    turnCounter = in.turnCounter;
+    currentState = (CombatState)in.combatState;
+    actionsChosen = false;
+    RngService::get(RNG_COMBAT).setState(in.rngState);
+    return true;
+}
+
+bool CombatManager::undoLastTurn() {
+    if (!hasLastTurnSnapshot) return false;
+    
+    hasLastTurnSnapshot = false;
+    return restoreSnapshot(lastTurnSnapshot);
+}
+
 // Information getters
 CombatState CombatManager::getCurrentState() const {
     return currentState;
@@ -224,13 +386,15 @@ void CombatManager::printCombatStatus() const {
     if (!player || !currentEnemy) return;
     
     Serial.println("=== Combat Status ===");
-    Serial.print(player->getName() + ": ");
+    Serial.print(player->getName());
+    Serial.print(": ");
     Serial.print(player->getCurrentHP());
     Serial.print("/");
     Serial.print(player->getMaxHP());
     Serial.println(" HP");
     
-    Serial.print(currentEnemy->getName() + ": ");
+    Serial.print(currentEnemy->getName());
+    Serial.print(": ");
     Serial.print(currentEnemy->getCurrentHP());
     Serial.print("/");
     Serial.print(currentEnemy->getMaxHP());
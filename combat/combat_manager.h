@@ -3,23 +3,23 @@
 
 #include "../entities/player.h"
 #include "../entities/enemy.h"
+#include "combat_snapshot.h"
 #include <Arduino.h>
 
 // Forward declarations
 class DamageCalculator;
 class TurnQueue;
 
-enum CombatState {
-    COMBAT_CHOOSE_ACTIONS,    // Both choose actions
-    COMBAT_EXECUTE_ACTIONS,   // Execute actions in order
-    COMBAT_PLAYER_WIN,
-    COMBAT_PLAYER_LOSE
-};
+// Safety cap so an auto-resolved fight always finishes
+static const int AUTO_RESOLVE_MAX_TURNS = 200;
 
-enum CombatResult {
-    RESULT_ONGOING,
-    RESULT_VICTORY,
-    RESULT_DEFEAT
+// What happened in an auto-resolved fight (for the summary screen)
+struct AutoResolveSummary {
+    CombatResult result;
+    int turns;
+    int damageTaken;
+    int damageDealt;
+    int potionsUsed;
 };
 
 class CombatManager {
@@ -34,6 +34,13 @@ private:
     EnemyAction enemyAction;
     bool actionsChosen;
     
+    // Rollback point taken at the start of every turn
+    CombatSnapshot lastTurnSnapshot;
+    bool hasLastTurnSnapshot;
+    
+    // Serial combat log (off while auto-resolving)
+    bool verbose;
+    
 public:
     // Constructor
     CombatManager();
@@ -45,6 +52,11 @@ public:
     // Turn processing
     CombatResult processTurn(PlayerAction action);
     
+    // Auto-resolve: play the whole fight with the player policy in one call
+    CombatResult autoResolve(AutoResolveSummary& summary);
+    PlayerAction chooseAutoAction() const;
+    void setVerbose(bool enabled);
+    
     // Action execution
     void executePlayerAction();
     void executeEnemyAction();
@@ -55,6 +67,11 @@ public:
     CombatState getCurrentState() const;
     int getTurnCounter() const;
     
+    // Snapshots (save/restore the whole fight in O(1))
+    void saveSnapshot(CombatSnapshot& out) const;
+    bool restoreSnapshot(const CombatSnapshot& in);
+    bool undoLastTurn();
+    
     // Entity access
     Player* getPlayer() const;
     Enemy* getCurrentEnemy() const;
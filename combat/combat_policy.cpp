@@ -0,0 +1,41 @@
+#include "combat_policy.h"
+
+// Table layout
+uint32_t CombatPolicy::getTableSize(int playerMaxHP, int enemyMaxHP, int maxPotions) {
+    return (uint32_t)(playerMaxHP + 1) * (enemyMaxHP + 1) * (maxPotions + 1) * 4;
+}
+
+uint32_t CombatPolicy::getIndex(const CombatPolicyTable& table, int playerHP, int enemyHP,
+                                int potions, bool playerDefending, bool enemyDefending) {
+    // Clamp into the table (extra potions are treated as the cap)
+    if (playerHP < 0) playerHP = 0;
+    if (playerHP > table.playerMaxHP) playerHP = table.playerMaxHP;
+    if (enemyHP < 0) enemyHP = 0;
+    if (enemyHP > table.enemyMaxHP) enemyHP = table.enemyMaxHP;
+    if (potions < 0) potions = 0;
+    if (potions > table.maxPotions) potions = table.maxPotions;
+    
+    uint32_t index = (uint32_t)playerHP * (table.enemyMaxHP + 1) + enemyHP;
+    index = index * (table.maxPotions + 1) + potions;
+    index = index * 2 + (playerDefending ? 1 : 0);
+    index = index * 2 + (enemyDefending ? 1 : 0);
+    return index;
+}
+
+// Entry packing
+uint8_t CombatPolicy::packEntry(PlayerAction action, double winChance) {
+    if (winChance < 0.0) winChance = 0.0;
+    if (winChance > 1.0) winChance = 1.0;
+    
+    int level = (int)(winChance * POLICY_VALUE_LEVELS + 0.5);
+    return (uint8_t)((level << 2) | ((int)action & 0x03));
+}
+
+PlayerAction CombatPolicy::unpackAction(uint8_t entry) {
+    return (PlayerAction)(entry & 0x03);
+}
+
+int CombatPolicy::unpackWinPercent(uint8_t entry) {
+    return ((entry >> 2) * 100 + POLICY_VALUE_LEVELS / 2) / POLICY_VALUE_LEVELS;
+}
+
@@ -0,0 +1,47 @@
+#ifndef COMBAT_POLICY_H
+#define COMBAT_POLICY_H
+
+#include <stdint.h>
+#include "combat_types.h"
+
+// Potions and defend stacks above these are looked up as the cap
+static const int POLICY_MAX_POTIONS = 3;
+static const int POLICY_VALUE_LEVELS = 63;
+
+// Precomputed optimal play for one player build against one enemy type.
+// One byte per state: bits 0-1 = best PlayerAction, bits 2-7 = win chance (0-63).
+// State = player HP x enemy HP x potions (capped) x player defending x enemy defending.
+// Tables are produced by tools/policy_solver.cpp (value iteration over CombatRules)
+// for balance analysis on the host. A table only fits one exact player build
+// against one enemy on one floor, and levels, gear and floor scaling change
+// both sides, so none are shipped and the game does not look them up.
+struct CombatPolicyTable {
+    // Build the table was solved for
+    int16_t playerMaxHP;
+    int16_t playerAttack;
+    int16_t playerDefense;
+    int16_t playerSpeed;
+    int16_t enemyMaxHP;
+    int16_t enemyAttack;
+    int16_t enemyDefense;
+    int16_t enemySpeed;
+    uint8_t enemyAIType;
+    uint8_t maxPotions;
+    
+    const uint8_t* entries;
+};
+
+class CombatPolicy {
+public:
+    // Table layout
+    static uint32_t getTableSize(int playerMaxHP, int enemyMaxHP, int maxPotions);
+    static uint32_t getIndex(const CombatPolicyTable& table, int playerHP, int enemyHP,
+                             int potions, bool playerDefending, bool enemyDefending);
+    
+    // Entry packing
+    static uint8_t packEntry(PlayerAction action, double winChance);
+    static PlayerAction unpackAction(uint8_t entry);
+    static int unpackWinPercent(uint8_t entry);
+};
+
+#endif
@@ -0,0 +1,199 @@
+#include "combat_rules.h"
+#include "../utils/constants.h"
+
+// Action priorities (lower goes first) - same order as TurnQueue
+static int getPlayerActionPriority(PlayerAction action) {
+    switch(action) {
+        case ACTION_DEFEND: return 0;
+        case ACTION_USE_ITEM: return 1;
+        case ACTION_ATTACK:
+        default: return 2;
+    }
+}
+
+static int getEnemyActionPriority(EnemyAction action) {
+    return (action == ENEMY_DEFEND) ? 0 : 2;
+}
+
+// Enemy AI
+int CombatRules::getEnemyAttackChance(AIType aiType) {
+    switch(aiType) {
+        case AI_AGGRESSIVE: return 80;
+        case AI_DEFENSIVE: return 40;
+        case AI_BERSERKER: return 90;
+        case AI_BALANCED:
+        default: return 60;
+    }
+}
+
+EnemyAction CombatRules::chooseEnemyAction(AIType aiType, Rng& rng) {
+    int roll = rng.range(1, 101); // Random number 1-100
+    return (roll <= getEnemyAttackChance(aiType)) ? ENEMY_ATTACK : ENEMY_DEFEND;
+}
+
+// AI attack multipliers
+float CombatRules::getAIAttackMultiplier(AIType aiType) {
+    switch(aiType) {
+        case AI_BERSERKER:
+            return 1.2f;  // +20% attack damage
+        case AI_AGGRESSIVE:
+            return 1.1f;  // +10% attack damage
+        case AI_DEFENSIVE:
+            return 0.9f;  // -10% attack damage
+        case AI_BALANCED:
+        default:
+            return 1.0f;  // No modifier
+    }
+}
+
+// AI defense multipliers
+float CombatRules::getAIDefenseMultiplier(AIType aiType) {
+    switch(aiType) {
+        case AI_DEFENSIVE:
+            return 1.5f;  // +50% defense
+        case AI_BALANCED:
+            return 1.0f;  // No modifier
+        case AI_AGGRESSIVE:
+            return 0.9f;  // -10% defense
+        case AI_BERSERKER:
+            return 0.7f;  // -30% defense
+        default:
+            return 1.0f;
+    }
+}
+
+int CombatRules::calculateEnemyAttackDamage(int attack, AIType aiType) {
+    float multiplier = getAIAttackMultiplier(aiType);
+    return (int)(attack * multiplier);
+}
+
+bool CombatRules::doesPlayerGoFirst(PlayerAction playerAction, EnemyAction enemyAction,
+                                    int playerSpeed, int enemySpeed) {
+    int playerPriority = getPlayerActionPriority(playerAction);
+    int enemyPriority = getEnemyActionPriority(enemyAction);
+    
+    if (playerPriority != enemyPriority) {
+        return playerPriority < enemyPriority;
+    }
+    return playerSpeed >= enemySpeed;
+}
+
+int CombatRules::applyDamage(EntitySnapshot& target, int damage) {
+    int actualDamage = damage - (target.defense + target.temporaryDefense);
+    if (actualDamage < MIN_DAMAGE) {
+        actualDamage = MIN_DAMAGE;
+    }
+    
+    int hp = target.currentHP - actualDamage;
+    target.currentHP = (int16_t)(hp < 0 ? 0 : hp);
+    
+    // Taking a hit uses up the defend bonus
+    target.temporaryDefense = 0;
+    target.isDefending = 0;
+    return actualDamage;
+}
+
+void CombatRules::executePlayerAction(CombatSnapshot& snapshot, PlayerAction action) {
+    EntitySnapshot& player = snapshot.player;
+    
+    switch(action) {
+        case ACTION_ATTACK:
+            applyDamage(snapshot.enemy, player.attack);
+            if (snapshot.enemy.currentHP <= 0) {
+                snapshot.combatState = COMBAT_PLAYER_WIN;
+            }
+            break;
+            
+        case ACTION_DEFEND:
+            player.isDefending = 1;
+            player.temporaryDefense += player.defense;
+            break;
+            
+        case ACTION_USE_ITEM:
+            if (snapshot.healthPotions > 0) {
+                snapshot.healthPotions--;
+                int hp = player.currentHP + POTION_HEAL_AMOUNT;
+                player.currentHP = (int16_t)(hp > player.maxHP ? player.maxHP : hp);
+            }
+            break;
+    }
+}
+
+void CombatRules::executeEnemyAction(CombatSnapshot& snapshot, EnemyAction action) {
+    EntitySnapshot& enemy = snapshot.enemy;
+    
+    if (action == ENEMY_ATTACK) {
+        applyDamage(snapshot.player, calculateEnemyAttackDamage(enemy.attack, (AIType)enemy.aiType));
+        if (snapshot.player.currentHP <= 0) {
+            snapshot.combatState = COMBAT_PLAYER_LOSE;
+        }
+    } else {
+        enemy.isDefending = 1;
+        enemy.temporaryDefense += enemy.defense;
+    }
+}
+
+CombatResult CombatRules::applyTurn(CombatSnapshot& snapshot, PlayerAction playerAction,
+                                    EnemyAction enemyAction) {
+    if (snapshot.combatState != COMBAT_CHOOSE_ACTIONS) {
+        return getResult(snapshot);
+    }
+    
+    if (doesPlayerGoFirst(playerAction, enemyAction, snapshot.player.speed, snapshot.enemy.speed)) {
+        executePlayerAction(snapshot, playerAction);
+        if (snapshot.combatState == COMBAT_CHOOSE_ACTIONS) {
+            executeEnemyAction(snapshot, enemyAction);
+        }
+    } else {
+        executeEnemyAction(snapshot, enemyAction);
+        if (snapshot.combatState == COMBAT_CHOOSE_ACTIONS) {
+            executePlayerAction(snapshot, playerAction);
+        }
+    }
+    
+    snapshot.turnCounter++;
+    return getResult(snapshot);
+}
+
+CombatResult CombatRules::stepTurn(CombatSnapshot& snapshot, PlayerAction playerAction) {
+    if (snapshot.combatState != COMBAT_CHOOSE_ACTIONS) {
+        return getResult(snapshot);
+    }
+    
+    Rng rng;
+    rng.setState(snapshot.rngState);
+    EnemyAction enemyAction = chooseEnemyAction((AIType)snapshot.enemy.aiType, rng);
+    rng.getState(snapshot.rngState);
+    
+    return applyTurn(snapshot, playerAction, enemyAction);
+}
+
+CombatResult CombatRules::getResult(const CombatSnapshot& snapshot) {
+    switch(snapshot.combatState) {
+        case COMBAT_PLAYER_WIN:
+            return RESULT_VICTORY;
+        case COMBAT_PLAYER_LOSE:
+            return RESULT_DEFEAT;
+        default:
+            return RESULT_ONGOING;
+    }
+}
+
+void CombatRules::beginFight(CombatSnapshot& snapshot, const FighterStats& player,
+                             const FighterStats& enemy, AIType enemyAI, int potions, uint32_t seed) {
+    memset(&snapshot, 0, sizeof(snapshot));
+    snapshot.player.currentHP = snapshot.player.maxHP = (int16_t)player.hp;
+    snapshot.player.attack = (int16_t)player.attack;
+    snapshot.player.defense = (int16_t)player.defense;
+    snapshot.player.speed = (int16_t)player.speed;
+    snapshot.enemy.currentHP = snapshot.enemy.maxHP = (int16_t)enemy.hp;
+    snapshot.enemy.attack = (int16_t)enemy.attack;
+    snapshot.enemy.defense = (int16_t)enemy.defense;
+    snapshot.enemy.speed = (int16_t)enemy.speed;
+    snapshot.enemy.aiType = (uint8_t)enemyAI;
+    snapshot.healthPotions = (uint8_t)potions;
+    snapshot.turnCounter = 1;
+    snapshot.combatState = COMBAT_CHOOSE_ACTIONS;
+    Rng rng(seed);
+    rng.getState(snapshot.rngState);
+}
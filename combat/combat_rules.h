@@ -0,0 +1,56 @@
+#ifndef COMBAT_RULES_H
+#define COMBAT_RULES_H
+
+#include "combat_types.h"
+#include "combat_snapshot.h"
+#include "../utils/rng.h"
+
+// Starting stats of one side of a fight
+struct FighterStats {
+    int hp;
+    int attack;
+    int defense;
+    int speed;
+};
+
+// The turn rules of CombatManager, expressed on a CombatSnapshot.
+// No Serial, no Strings, no Player/Enemy objects - so the policy solver,
+// batch simulators and host tools resolve turns exactly like the game does.
+class CombatRules {
+public:
+    // Enemy AI
+    static int getEnemyAttackChance(AIType aiType);   // Percent chance to attack
+    static EnemyAction chooseEnemyAction(AIType aiType, Rng& rng);
+    
+    // AI modifiers
+    static float getAIAttackMultiplier(AIType aiType);
+    static float getAIDefenseMultiplier(AIType aiType);
+    static int calculateEnemyAttackDamage(int attack, AIType aiType);
+    
+    // Turn order (defend > item > attack, then speed, player wins ties)
+    static bool doesPlayerGoFirst(PlayerAction playerAction, EnemyAction enemyAction,
+                                  int playerSpeed, int enemySpeed);
+    
+    // Damage after defense (same as Entity::takeDamage); clears defend state
+    static int applyDamage(EntitySnapshot& target, int damage);
+    
+    // Resolve one full turn with both actions already chosen
+    static CombatResult applyTurn(CombatSnapshot& snapshot, PlayerAction playerAction,
+                                  EnemyAction enemyAction);
+    
+    // Resolve one full turn, rolling the enemy action from the snapshot's RNG state
+    static CombatResult stepTurn(CombatSnapshot& snapshot, PlayerAction playerAction);
+    
+    // Result of a snapshot's current state
+    static CombatResult getResult(const CombatSnapshot& snapshot);
+    
+    // Fresh fight at turn 1: both sides at full HP, combat RNG seeded from seed
+    static void beginFight(CombatSnapshot& snapshot, const FighterStats& player,
+                           const FighterStats& enemy, AIType enemyAI, int potions, uint32_t seed);
+    
+private:
+    static void executePlayerAction(CombatSnapshot& snapshot, PlayerAction action);
+    static void executeEnemyAction(CombatSnapshot& snapshot, EnemyAction action);
+};
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef COMBAT_SNAPSHOT_H
+#define COMBAT_SNAPSHOT_H
+
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+
+// Everything about one combatant that can change during a fight.
+// Plain data only - no Strings, no pointers.
+struct EntitySnapshot {
+    int16_t currentHP;
+    int16_t maxHP;
+    int16_t attack;
+    int16_t defense;
+    int16_t speed;
+    int16_t temporaryDefense;
+    uint8_t isDefending;
+    uint8_t aiType;           // Enemy only (AIType), 0 for the player
+};
+
+// Complete resumable state of a 1v1 fight.
+// Copying one is a memcpy, so AI search, undo and the batch
+// simulators can clone fights without touching Player/Enemy objects.
+struct CombatSnapshot {
+    EntitySnapshot player;
+    EntitySnapshot enemy;
+    uint16_t turnCounter;
+    uint8_t combatState;      // CombatState
+    uint8_t healthPotions;
+    uint32_t rngState[4];     // Combat RNG stream
+};
+
+static_assert(std::is_trivially_copyable<CombatSnapshot>::value, "CombatSnapshot must stay POD");
+static_assert(sizeof(CombatSnapshot) <= 64, "CombatSnapshot should fit in a few dozen bytes");
+
+// O(1) copy helper
+inline void copyCombatSnapshot(CombatSnapshot& dst, const CombatSnapshot& src) {
+    memcpy(&dst, &src, sizeof(CombatSnapshot));
+}
+
+#endif
@@ -0,0 +1,38 @@
+#ifndef COMBAT_TYPES_H
+#define COMBAT_TYPES_H
+
+// Shared combat enums. Kept free of Arduino includes so the rules,
+// solvers and host tools can use them too.
+
+enum PlayerAction {
+    ACTION_ATTACK = 0,
+    ACTION_DEFEND = 1,
+    ACTION_USE_ITEM = 2
+};
+
+enum AIType {
+    AI_AGGRESSIVE,   // Always attacks (80% attack, 20% defend)
+    AI_DEFENSIVE,    // Prefers to defend (40% attack, 60% defend)
+    AI_BALANCED,     // Mix of attack/defend (60% attack, 40% defend)
+    AI_BERSERKER     // High damage, risky (90% attack, 10% defend)
+};
+
+enum EnemyAction {
+    ENEMY_ATTACK = 0,
+    ENEMY_DEFEND = 1
+};
+
+enum CombatState {
+    COMBAT_CHOOSE_ACTIONS,    // Both choose actions
+    COMBAT_EXECUTE_ACTIONS,   // Execute actions in order
+    COMBAT_PLAYER_WIN,
+    COMBAT_PLAYER_LOSE
+};
+
+enum CombatResult {
+    RESULT_ONGOING,
+    RESULT_VICTORY,
+    RESULT_DEFEAT
+};
+
+#endif
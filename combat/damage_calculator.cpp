@@ -1,4 +1,5 @@
 #include "damage_calculator.h"
+#include "combat_rules.h"
 #include "../utils/constants.h"
 
 // Player attack damage (no AI modifiers)
@@ -43,8 +44,7 @@ int DamageCalculator::calculateFinalDamage(int baseDamage, int totalDefense) {
 
 // Apply AI-specific attack modifiers
 int DamageCalculator::applyAIAttackModifier(int baseDamage, AIType aiType) {
-    float multiplier = getAIAttackMultiplier(aiType);
-    return (int)(baseDamage * multiplier);
+    return CombatRules::calculateEnemyAttackDamage(baseDamage, aiType);
 }
 
 // Apply AI-specific defense modifiers
@@ -58,33 +58,11 @@ int DamageCalculator::calculatePotionHealing() {
     return POTION_HEAL_AMOUNT;
 }
 
-// AI attack multipliers
+// AI multipliers (shared with CombatRules so simulations match the game)
 float DamageCalculator::getAIAttackMultiplier(AIType aiType) {
-    switch(aiType) {
-        case AI_BERSERKER:
-            return 1.2f;  // +20% attack damage
-        case AI_AGGRESSIVE:
-            return 1.1f;  // +10% attack damage
-        case AI_DEFENSIVE:
-            return 0.9f;  // -10% attack damage
-        case AI_BALANCED:
-        default:
-            return 1.0f;  // No modifier
-    }
+    return CombatRules::getAIAttackMultiplier(aiType);
 }
 
-// AI defense multipliers
 float DamageCalculator::getAIDefenseMultiplier(AIType aiType) {
-    switch(aiType) {
-        case AI_DEFENSIVE:
-            return 1.5f;  // +50% defense
-        case AI_BALANCED:
-            return 1.0f;  // No modifier
-        case AI_AGGRESSIVE:
-            return 0.9f;  // -10% defense
-        case AI_BERSERKER:
-            return 0.7f;  // -30% defense
-        default:
-            return 1.0f;
-    }
+    return CombatRules::getAIDefenseMultiplier(aiType);
 }
@@ -1,4 +1,5 @@
 #include "turn_queue.h"
+#include "combat_rules.h"
 
 // Static helper functions for TurnAction
 ActionPriority TurnAction::getPlayerActionPriority(PlayerAction action) {
@@ -18,15 +19,9 @@ TurnQueue::TurnQueue(Player* player, Enemy* enemy, PlayerAction pAction, EnemyAc
 
 // Calculate who goes first based on priority and speed
 void TurnQueue::calculateTurnOrder() {
-    // Compare priorities first (lower number = higher priority)
-    if (playerTurn.priority < enemyTurn.priority) {
-        playerGoesFirst = true;
-    } else if (enemyTurn.priority < playerTurn.priority) {
-        playerGoesFirst = false;
-    } else {
-        // Same priority - use speed (higher speed wins, player wins ties)
-        playerGoesFirst = (playerTurn.speed >= enemyTurn.speed);
-    }
+    // Priority first (lower number = higher priority), then speed (player wins ties)
+    playerGoesFirst = CombatRules::doesPlayerGoFirst(playerTurn.playerAction, enemyTurn.enemyAction,
+                                                     playerTurn.speed, enemyTurn.speed);
 }
 
 // Check if player goes first
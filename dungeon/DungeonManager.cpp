@@ -1,31 +1,37 @@
 #include "DungeonManager.h"
 #include "../utils/constants.h"
+#include "../utils/rng.h"
 
 DungeonManager::DungeonManager(Player* p) {
     player = p;
     currentFloor = nullptr;
+    nextFloor = &floors[1];
+    preGenerating = false;
     currentFloorNumber = 0;
     totalRoomsCompleted = 0;
 }
 
 void DungeonManager::startNewFloor() {
-    if (currentFloor) {
-        delete currentFloor;
-        currentFloor = nullptr;  // Ensure clean state
+    // Reset the floor in place - the whole room pool is dropped at once
+    if (!currentFloor) {
+        currentFloor = &floors[0];
     }
+    preGenerating = false;
+    nextFloor->reset(0);
     
     currentFloorNumber++;
-    currentFloor = new Floor(currentFloorNumber);
+    currentFloor->reset(currentFloorNumber);
     currentFloor->generateFloor();
     
     Serial.println("DungeonManager: Started fresh floor " + String(currentFloorNumber));
     Serial.println("Rooms completed reset to 0");
 }
 
-std::vector<DoorChoice> DungeonManager::getAvailableRooms() {
+const DoorChoice* DungeonManager::getAvailableRooms(int& count) {
     if (!currentFloor) {
         startNewFloor();
     }
+    count = currentFloor->getChoiceCount();
     return currentFloor->getAvailableChoices();
 }
 
@@ -33,33 +39,80 @@ Room* DungeonManager::selectRoom(int choice) {
     if (!currentFloor) return nullptr;
     
     if (currentFloor->enterRoom(choice)) {
-        return currentFloor->getCurrentRoom();
+        Room* room = currentFloor->getCurrentRoom();
+        
+        // Build the next floor in idle frames while the boss fight runs
+        if (room && room->getType() == ROOM_BOSS) {
+            startPreGeneration();
+        }
+        return room;
     }
     return nullptr;
 }
 
 void DungeonManager::markRoomCompleted() {
     if (currentFloor) {
+        Room* room = currentFloor->getCurrentRoom();
         currentFloor->incrementRoomsCompleted();
         totalRoomsCompleted++;
         
         if (currentFloor->isFloorComplete() && !currentFloor->isBossRoomReady()) {
             Serial.println("Floor " + String(currentFloorNumber) + " complete!");
         }
+        
+        // Boss cleared - move on to the (already built) next floor
+        if (room && room->getType() == ROOM_BOSS) {
+            Serial.println("Boss defeated on floor " + String(currentFloorNumber));
+            advanceToNextFloor();
+        }
     }
 }
 
+// Swap to the pre-generated floor. If pre-generation didn't get enough idle
+// frames, the remaining steps are finished here first.
 void DungeonManager::advanceToNextFloor() {
-    startNewFloor();
+    if (!currentFloor) {
+        startNewFloor();
+        return;
+    }
+    
+    if (!preGenerating) {
+        startPreGeneration();
+    }
+    while (!nextFloor->generateStep()) {
+        // Finish any work left over
+    }
+    
+    Floor* finished = currentFloor;
+    currentFloor = nextFloor;
+    nextFloor = finished;
+    preGenerating = false;
+    currentFloorNumber++;
+    
+    Serial.println("DungeonManager: Advanced to floor " + String(currentFloorNumber));
+}
+
+void DungeonManager::startPreGeneration() {
+    if (preGenerating) return;
+    
+    int floorNumber = currentFloorNumber + 1;
+    nextFloor->beginGeneration(floorNumber, FloorGraphGen::floorSeed(RngService::getRunSeed(), floorNumber));
+    preGenerating = true;
+    Serial.println("DungeonManager: Pre-generating floor " + String(floorNumber));
+}
+
+void DungeonManager::update() {
+    if (preGenerating && !nextFloor->isGenerated()) {
+        nextFloor->generateStep();
+    }
+}
+
+bool DungeonManager::isNextFloorReady() const {
+    return preGenerating && nextFloor->isGenerated();
 }
 
 void DungeonManager::resetToFirstFloor() {
     // Complete reset - go back to floor 1
-    if (currentFloor) {
-        delete currentFloor;
-        currentFloor = nullptr;
-    }
-    
     currentFloorNumber = 0;  // Will become 1 when startNewFloor is called
     totalRoomsCompleted = 0;
     
@@ -88,8 +141,59 @@ bool DungeonManager::isBossRoomAvailable() const {
     return currentFloor ? currentFloor->isBossRoomReady() : false;
 }
 
-DungeonManager::~DungeonManager() {
+void DungeonManager::captureRunState(DungeonRunState& state) const {
+    RunState::clear(state);
+    state.runSeed = RngService::getRunSeed();
+    state.totalRoomsCompleted = (uint16_t)totalRoomsCompleted;
+    for (int s = 0; s < RNG_STREAM_COUNT; s++) {
+        RngService::get((RngStream)s).getState(state.rngState[s]);
+    }
+    
     if (currentFloor) {
-        delete currentFloor;
+        currentFloor->captureRooms(state);
+    }
+}
+
+// Rebuild the floor from its seed in the spare buffer and check it against
+// the saved rooms. The live run is only touched once the state is accepted.
+bool DungeonManager::restoreRunState(const DungeonRunState& state) {
+    if (!RunState::isValid(state) || state.floorNumber == 0) {
+        Serial.println("DungeonManager: Invalid run state");
+        return false;
     }
+    
+    // Any half-built next floor is dropped - it is rebuilt on demand
+    preGenerating = false;
+    nextFloor->reset(state.floorNumber);
+    nextFloor->generateFloor(state.floorSeed);
+    
+    if (!nextFloor->restoreRooms(state)) {
+        nextFloor->reset(0);
+        Serial.println("DungeonManager: Run state does not match the floor layout");
+        return false;
+    }
+    
+    RngService::seedRun(state.runSeed);
+    
+    // Before the first floor, nextFloor is floors[1] and floors[0] is unused
+    Floor* spare = currentFloor ? currentFloor : &floors[0];
+    currentFloor = nextFloor;
+    nextFloor = spare;
+    nextFloor->reset(0);
+    
+    currentFloorNumber = state.floorNumber;
+    totalRoomsCompleted = state.totalRoomsCompleted;
+    
+    // Random streams last, so generation above doesn't disturb them
+    for (int s = 0; s < RNG_STREAM_COUNT; s++) {
+        RngService::get((RngStream)s).setState(state.rngState[s]);
+    }
+    
+    Serial.println("DungeonManager: Restored floor " + String(currentFloorNumber) + 
+                   " (state " + String(RunState::hash(state), HEX) + ")");
+    return true;
+}
+
+DungeonManager::~DungeonManager() {
+    currentFloor = nullptr;
 }
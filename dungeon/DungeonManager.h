@@ -3,12 +3,15 @@
 
 #include "Floor.h"
 #include "../entities/player.h"
-#include <vector>
 
 class DungeonManager {
 private:
     Player* player;
-    Floor* currentFloor;
+    // Double-buffered floors: the next one is built while the boss fight runs
+    Floor floors[2];
+    Floor* currentFloor;  // nullptr until the first floor starts
+    Floor* nextFloor;
+    bool preGenerating;
     int currentFloorNumber;
     int totalRoomsCompleted;
     
@@ -21,8 +24,13 @@ public:
     void advanceToNextFloor();
     void resetToFirstFloor();  // Add explicit reset method
     
+    // Background pre-generation of the next floor
+    void update();  // Call once per frame
+    void startPreGeneration();
+    bool isNextFloorReady() const;
+    
     // Room management
-    std::vector<DoorChoice> getAvailableRooms();
+    const DoorChoice* getAvailableRooms(int& count);
     Room* selectRoom(int choice);  // 0 = left, 1 = right
     void markRoomCompleted();
     
@@ -33,6 +41,10 @@ public:
     int getTotalRoomsCompleted() const;
     bool isBossRoomAvailable() const;
     
+    // Compact run state (save files, replays, hashing)
+    void captureRunState(DungeonRunState& state) const;
+    bool restoreRunState(const DungeonRunState& state);
+    
     // Cleanup
     ~DungeonManager();
 };
@@ -1,113 +1,197 @@
 #include "Floor.h"
+#include "../utils/rng.h"
 #include <Arduino.h>
 
+// Keeps shop stock seeds apart from the floor layout seed
+static const uint32_t SHOP_SEED_SALT = 0x2000;
+
 Floor::Floor(int floorNum) {
+    reset(floorNum);
+}
+
+// Drop every room on the floor at once - nothing is freed, the pool is just rewound
+void Floor::reset(int floorNum) {
     floorNumber = floorNum;
     currentRoom = nullptr;
     roomsCompleted = 0;
-    rooms.clear();
+    currentNode = FLOOR_NODE_NONE;
+    roomsAllocated = 0;
+    choiceCount = 0;
+    choicesValid = false;
+    genPhase = FLOOR_GEN_IDLE;
+    genSeed = 0;
+    genIndex = 0;
 }
 
+// Graph node types are stored as RoomType values
+static_assert((int)NODE_ENEMY == (int)ROOM_ENEMY && (int)NODE_TREASURE == (int)ROOM_TREASURE &&
+              (int)NODE_SHOP == (int)ROOM_SHOP && (int)NODE_BOSS == (int)ROOM_BOSS,
+              "FloorNodeType must match RoomType");
+
 void Floor::generateFloor() {
+    generateFloor(FloorGraphGen::floorSeed(RngService::getRunSeed(), floorNumber));
+}
+
+void Floor::generateFloor(uint32_t seed) {
     Serial.println("Generating Floor " + String(floorNumber) + "...");
     
-    // Clear existing rooms
-    for (Room* room : rooms) {
-        delete room;
+    beginGeneration(floorNumber, seed);
+    while (!generateStep()) {
+        // Run every phase now
     }
-    rooms.clear();
     
-    // Create boss room
-    Room* bossRoom = new Room(999, ROOM_BOSS);
-    bossRoom->setEnemyType(3); // Orc boss
-    rooms.push_back(bossRoom);
+    Serial.println("Floor " + String(floorNumber) + " initialized (" + String(graph.nodeCount) + " rooms).");
+}
+
+void Floor::beginGeneration(int floorNum, uint32_t seed) {
+    reset(floorNum);
+    genSeed = seed;
+    genPhase = FLOOR_GEN_LAYOUT;
+}
+
+// One slice of work per call: the layout first, then one room at a time
+bool Floor::generateStep() {
+    switch (genPhase) {
+        case FLOOR_GEN_LAYOUT:
+            FloorGraphGen::generate(graph, floorNumber, genSeed);
+            genIndex = 0;
+            genPhase = FLOOR_GEN_ROOMS;
+            return false;
+            
+        case FLOOR_GEN_ROOMS:
+            if (genIndex < graph.nodeCount) {
+                buildRoom(genIndex++);
+            }
+            if (genIndex >= graph.nodeCount) {
+                genPhase = FLOOR_GEN_DONE;
+                return true;
+            }
+            return false;
+            
+        case FLOOR_GEN_DONE:
+            return true;
+            
+        default:
+            return false; // Nothing started
+    }
+}
+
+bool Floor::isGenerated() const {
+    return genPhase == FLOOR_GEN_DONE;
+}
+
+Room* Floor::allocateRoom(int roomID, RoomType type) {
+    if (roomsAllocated >= FLOOR_ROOM_CAPACITY) {
+        return nullptr;
+    }
     
-    Serial.println("Floor " + String(floorNumber) + " initialized.");
+    Room* room = &roomPool[roomsAllocated++];
+    room->reset(roomID, type);
+    return room;
 }
 
-RoomType Floor::selectRandomRoomType() {
-    int roll = random(1, 101); // 1-100
+// Room i is graph node i (boss room is always the first slot)
+void Floor::buildRoom(int nodeIndex) {
+    uint32_t node = graph.nodes[nodeIndex];
+    RoomType type = (RoomType)FloorGraphGen::getType(node);
+    int roomID = (nodeIndex == FLOOR_BOSS_NODE) ? 999 :
+                 FloorGraphGen::getLayer(node) * 10 + FloorGraphGen::getSlot(node);
     
-    if (roll <= 60) {
-        return ROOM_ENEMY;
-    } else if (roll <= 85) {
-        return ROOM_TREASURE;
-    } else {
-        return ROOM_SHOP;
+    Room* room = allocateRoom(roomID, type);
+    if (!room) return;
+    room->setFloorNumber(floorNumber);
+    
+    switch (type) {
+        case ROOM_ENEMY:
+        case ROOM_BOSS:
+            room->setEnemyType(FloorGraphGen::getEnemyID(node));
+            break;
+        case ROOM_TREASURE:
+            room->setTreasure(FloorGraphGen::getTreasureType(node), FloorGraphGen::getTreasureValue(node));
+            break;
+        case ROOM_SHOP:
+            room->generateShop(RngService::deriveSeed(genSeed, SHOP_SEED_SALT + (uint32_t)nodeIndex));
+            break;
+        default:
+            break;
     }
 }
 
+// The boss opens once the player stands in the last layer (or beyond it)
 bool Floor::isFloorComplete() const {
-    return roomsCompleted >= 3; // Reduced for testing
+    if (currentNode == FLOOR_NODE_NONE) return false;
+    if (currentNode == FLOOR_BOSS_NODE) return true;
+    return FloorGraphGen::getLayer(graph.nodes[currentNode]) >= FLOOR_GRAPH_LAYERS - 1;
 }
 
 Room* Floor::getCurrentRoom() const {
     return currentRoom;
 }
 
-std::vector<DoorChoice> Floor::getAvailableChoices() {
-    std::vector<DoorChoice> choices;
+void Floor::generateChoices() {
+    choiceCount = 0;
     
     Serial.println("Floor " + String(floorNumber) + ": Getting choices, rooms completed: " + String(roomsCompleted));
     
     if (isFloorComplete()) {
         Serial.println("Floor complete - offering boss room");
         // Only boss room available
-        DoorChoice bossChoice;
+        DoorChoice& bossChoice = choices[choiceCount++];
         bossChoice.room = getBossRoom();
         bossChoice.icon = ICON_SKULL;
         bossChoice.description = "Final challenge awaits";
-        choices.push_back(bossChoice);
+        bossChoice.maxTreasure = 0;
+        bossChoice.minFights = 1;
     } else {
-        Serial.println("Floor incomplete - generating 2 random rooms");
-        // Generate two fresh rooms
-        for (int i = 0; i < 2; i++) {
-            Room* newRoom = new Room(roomsCompleted * 10 + i, selectRandomRoomType());
-            
-            // Setup room content
-            switch(newRoom->getType()) {
-                case ROOM_ENEMY:
-                    {
-                        int enemyType = random(1, 4);
-                        newRoom->setEnemyType(enemyType);
-                    }
-                    break;
-                    
-                case ROOM_TREASURE:
-                    {
-                        int treasureType = random(1, 4);
-                        int treasureValue = floorNumber + random(1, 4);
-                        newRoom->setTreasure(treasureType, treasureValue);
-                    }
-                    break;
-                    
-                case ROOM_SHOP:
-                    // Shop setup handled in room
-                    break;
-                    
-                default:
-                    break;
-            }
+        // Route hints for every room, one linear pass over the DAG
+        FloorGraphGen::analyzeRoutes(graph, routes);
+        
+        // Doors are the edges out of the room we're standing in
+        const uint8_t* links = graph.entry;
+        int linkCount = graph.entryCount;
+        if (currentNode != FLOOR_NODE_NONE) {
+            links = &graph.edges[graph.edgeStart[currentNode]];
+            linkCount = FloorGraphGen::getOutDegree(graph, currentNode);
+        }
+        
+        for (int i = 0; i < linkCount && choiceCount < MAX_DOOR_CHOICES; i++) {
+            if (links[i] >= roomsAllocated) continue;
             
-            DoorChoice choice;
+            Room* newRoom = &roomPool[links[i]];
+            DoorChoice& choice = choices[choiceCount++];
             choice.room = newRoom;
             choice.icon = newRoom->getDoorIcon();
             choice.description = newRoom->getDescription();
-            choices.push_back(choice);
+            choice.maxTreasure = routes.maxTreasure[links[i]];
+            choice.minFights = routes.minFights[links[i]];
         }
     }
     
+    choicesValid = true;
+}
+
+// Choices are made once per step, so the doors shown are the doors entered
+const DoorChoice* Floor::getAvailableChoices() {
+    if (!choicesValid) {
+        generateChoices();
+    }
     return choices;
 }
 
+int Floor::getChoiceCount() {
+    if (!choicesValid) {
+        generateChoices();
+    }
+    return choiceCount;
+}
+
 bool Floor::enterRoom(int choice) {
-    std::vector<DoorChoice> choices = getAvailableChoices();
-    
-    if (choice < 0 || choice >= choices.size()) {
+    if (choice < 0 || choice >= getChoiceCount()) {
         return false;
     }
     
     currentRoom = choices[choice].room;
+    currentRoom->setVisited(true);
     return true;
 }
 
@@ -116,12 +200,16 @@ bool Floor::isBossRoomReady() const {
 }
 
 Room* Floor::getBossRoom() {
-    if (rooms.size() > 0) {
-        return rooms[0]; // Boss room
+    if (roomsAllocated > 0) {
+        return &roomPool[0]; // Boss room
     }
     return nullptr;
 }
 
+int Floor::getRoomsAllocated() const {
+    return roomsAllocated;
+}
+
 int Floor::getRoomsCompleted() const {
     return roomsCompleted;
 }
@@ -130,13 +218,74 @@ int Floor::getFloorNumber() const {
     return floorNumber;
 }
 
+const FloorGraph& Floor::getGraph() const {
+    return graph;
+}
+
+int Floor::getCurrentNode() const {
+    return currentNode;
+}
+
+bool Floor::isChoiceNode(int node) {
+    const DoorChoice* doors = getAvailableChoices();
+    for (int i = 0; i < choiceCount; i++) {
+        if (doors[i].room == &roomPool[node]) return true;
+    }
+    return false;
+}
+
 void Floor::incrementRoomsCompleted() {
+    if (!currentRoom) return;
+    
+    // Only a room we haven't moved on from yet counts as progress
+    uint8_t node = (uint8_t)(currentRoom - roomPool);
+    if (node == currentNode) return;
+    
     roomsCompleted++;
+    currentNode = node;   // Move on from the room just cleared
+    choicesValid = false; // Next step gets new doors
+}
+
+uint32_t Floor::getSeed() const {
+    return genSeed;
+}
+
+void Floor::captureRooms(DungeonRunState& state) const {
+    state.floorNumber = (uint8_t)floorNumber;
+    state.floorSeed = genSeed;
+    state.roomCount = (uint8_t)roomsAllocated;
+    state.roomsCompleted = (uint8_t)roomsCompleted;
+    state.currentNode = currentNode;
+    state.enteredNode = currentRoom ? (uint8_t)(currentRoom - roomPool) : FLOOR_NODE_NONE;
+    
+    for (int i = 0; i < roomsAllocated; i++) {
+        const Room& room = roomPool[i];
+        RunState::setRoomType(state, i, room.getType());
+        RunState::setFlag(state.completedMask, i, room.isCompleted());
+        RunState::setFlag(state.visitedMask, i, room.isVisited());
+        RunState::setFlag(state.lootedMask, i, room.isLooted());
+    }
 }
 
-Floor::~Floor() {
-    for (Room* room : rooms) {
-        delete room;
+// Call on a floor freshly generated from state.floorSeed
+bool Floor::restoreRooms(const DungeonRunState& state) {
+    if (state.roomCount != roomsAllocated) {
+        return false;
     }
-    rooms.clear();
+    
+    for (int i = 0; i < roomsAllocated; i++) {
+        Room& room = roomPool[i];
+        if (RunState::getRoomType(state, i) != room.getType()) {
+            return false; // Different layout - wrong seed or generator
+        }
+        room.setCompleted(RunState::getFlag(state.completedMask, i));
+        room.setVisited(RunState::getFlag(state.visitedMask, i));
+        room.setLooted(RunState::getFlag(state.lootedMask, i));
+    }
+    
+    roomsCompleted = state.roomsCompleted;
+    currentNode = state.currentNode;
+    currentRoom = (state.enteredNode < roomsAllocated) ? &roomPool[state.enteredNode] : nullptr;
+    choicesValid = false;
+    return true;
 }
@@ -2,32 +2,75 @@
 #define FLOOR_H
 
 #include "Room.h"
+#include "floor_graph.h"
+#include "run_state.h"
 #include "../entities/player.h"
-#include <vector>
+
+// One pooled Room per graph node
+static const int MAX_DOOR_CHOICES = FLOOR_NODE_LINKS;
+static const int FLOOR_ROOM_CAPACITY = FLOOR_GRAPH_MAX_NODES;
+
+// Incremental generation phases
+enum FloorGenPhase {
+    FLOOR_GEN_IDLE,
+    FLOOR_GEN_LAYOUT,
+    FLOOR_GEN_ROOMS,
+    FLOOR_GEN_DONE
+};
 
 struct DoorChoice {
     Room* room;
     DoorIcon icon;
-    String description;
+    const char* description;
+    
+    // Route hints (best routes from this door to the boss)
+    int maxTreasure;
+    int minFights;
 };
 
 class Floor {
 private:
     int floorNumber;
-    std::vector<Room*> rooms;
     Room* currentRoom;
     int roomsCompleted;
     
+    // Whole floor layout, generated up front from the run seed
+    FloorGraph graph;
+    FloorRoutes routes;
+    uint8_t currentNode;  // FLOOR_NODE_NONE = still at the entrance
+    
+    // Incremental generation state
+    FloorGenPhase genPhase;
+    uint32_t genSeed;
+    int genIndex;
+    
+    // Fixed-capacity room arena, reset in one step per floor
+    Room roomPool[FLOOR_ROOM_CAPACITY];
+    int roomsAllocated;
+    
+    // Door choices for the current step (generated once, cached until progress)
+    DoorChoice choices[MAX_DOOR_CHOICES];
+    int choiceCount;
+    bool choicesValid;
+    
     // Room generation
-    void generateRandomRoom(int roomID);
-    RoomType selectRandomRoomType();
+    Room* allocateRoom(int roomID, RoomType type);
+    void buildRoom(int nodeIndex);
+    void generateChoices();
     
 public:
     // Constructor
-    Floor(int floorNum);
+    Floor(int floorNum = 0);
     
     // Floor management
+    void reset(int floorNum);
     void generateFloor();
+    void generateFloor(uint32_t seed);
+    
+    // Incremental generation: a bounded slice of work per call (idle frames)
+    void beginGeneration(int floorNum, uint32_t seed);
+    bool generateStep();  // True once the floor is fully built
+    bool isGenerated() const;
     bool isFloorComplete() const;
     int getRoomsCompleted() const;
     void incrementRoomsCompleted();
@@ -35,15 +78,24 @@ public:
     
     // Room navigation
     Room* getCurrentRoom() const;
-    std::vector<DoorChoice> getAvailableChoices();
+    const DoorChoice* getAvailableChoices();
+    int getChoiceCount();
     bool enterRoom(int choice);
     
     // Boss room access
     bool isBossRoomReady() const;
     Room* getBossRoom();
     
-    // Cleanup
-    ~Floor();
+    // Layout access
+    const FloorGraph& getGraph() const;
+    int getCurrentNode() const;
+    bool isChoiceNode(int node);
+    int getRoomsAllocated() const;
+    uint32_t getSeed() const;
+    
+    // Run state (room flags and position; the layout comes from the seed)
+    void captureRooms(DungeonRunState& state) const;
+    bool restoreRooms(const DungeonRunState& state);
 };
 
 #endif
@@ -1,15 +1,29 @@
 #include "Room.h"
 #include "../utils/constants.h"
+#include "../utils/name_tables.h"
+#include "../utils/rng.h"
+#include "../item/item.h"
 
 // Constructor
+Room::Room() {
+    reset(0, ROOM_ENEMY);
+}
+
 Room::Room(int id, RoomType roomType) {
+    reset(id, roomType);
+}
+
+void Room::reset(int id, RoomType roomType) {
     roomID = id;
     type = roomType;
     completed = false;
+    visited = false;
+    looted = false;
+    floorNumber = 1;
     enemyTypeID = 1; // Default to Goblin
     treasureType = 0;
     treasureValue = 0;
-    shopVisited = false;
+    shop.slotCount = 0;
 }
 
 // Room properties
@@ -29,59 +43,162 @@ void Room::setCompleted(bool complete) {
     completed = complete;
 }
 
-// Create enemy based on room's enemy type
-Enemy Room::createEnemy() const {
-    switch(enemyTypeID) {
-        case 1:
-            return Enemy::createGoblin();
-        case 2:
-            return Enemy::createSkeleton();
-        case 3:
-            return Enemy::createOrc();
-        default:
-            return Enemy::createGoblin();
+bool Room::isVisited() const {
+    return visited;
+}
+
+void Room::setVisited(bool hasVisited) {
+    visited = hasVisited;
+}
+
+bool Room::isLooted() const {
+    return looted;
+}
+
+void Room::setLooted(bool hasLooted) {
+    looted = hasLooted;
+}
+
+int Room::getFloorNumber() const {
+    return floorNumber;
+}
+
+void Room::setFloorNumber(int floor) {
+    floorNumber = floor;
+}
+
+// Build the room's enemy in place from its archetype, scaled to this floor
+void Room::spawnEnemy(Enemy& enemy) const {
+    // Rooms without a real enemy type get a goblin
+    bool known = enemyTypeID > ENEMY_ID_UNKNOWN && enemyTypeID < ENEMY_ID_COUNT;
+    enemy.spawn(known ? enemyTypeID : ENEMY_ID_GOBLIN, floorNumber);
+}
+
+// Put a rolled item in the player's inventory. Stats are refreshed by the
+// caller once the whole batch of drops is in. Returns false if nothing
+// dropped or the drop didn't fit.
+static bool applyLoot(Player* player, const LootDrop& drop) {
+    if (drop.itemID == ITEM_ID_NONE || drop.quantity == 0) return false; // Nothing dropped
+    
+    if (!player->giveItem(drop.itemID, drop.quantity)) {
+        Serial.println(String("No room for ") + ItemCatalog::getName(drop.itemID) + " - left behind");
+        return false;
     }
+    return true;
 }
 
-// Give treasure to player
-void Room::giveTreasure(Player* player) {
-    if (completed) return; // Already looted
+// Give treasure to player: one loot roll per treasure type level, plus gold
+int Room::giveTreasure(Player* player, LootDrop* found, int maxFound) {
+    if (looted) return 0;
     
-    switch(treasureType) {
-        case 1: // Health Potions
-            player->addHealthPotions(treasureValue);
-            Serial.println("Found " + String(treasureValue) + " health potions!");
-            break;
-        case 2: // Equipment Bonus
-            player->addEquipmentBonus(treasureValue, treasureValue, treasureValue, treasureValue);
-            Serial.println("Found magical equipment! (+" + String(treasureValue) + " to all stats)");
-            break;
-        case 3: // Large Equipment Bonus
-            player->addEquipmentBonus(treasureValue * 2, treasureValue, treasureValue, 0);
-            Serial.println("Found powerful armor! (+" + String(treasureValue * 2) + " HP, +" + String(treasureValue) + " ATK/DEF)");
-            break;
-        default:
-            player->addHealthPotions(2);
-            Serial.println("Found 2 health potions!");
-            break;
+    Rng& rng = RngService::get(RNG_LOOT);
+    int rolls = treasureType;
+    if (rolls < 1) rolls = 1;
+    if (rolls > maxFound) rolls = maxFound;
+    
+    // Only drops that landed in the inventory are reported
+    int kept = 0;
+    for (int i = 0; i < rolls; i++) {
+        LootDrop drop = LootTables::roll(LOOT_TREASURE, floorNumber, rng);
+        if (!applyLoot(player, drop)) continue;
+        found[kept++] = drop;
+        Serial.println(String("Found ") + String(drop.quantity) + "x " + ItemCatalog::getName(drop.itemID));
     }
     
+    player->refreshStats();
+    
+    int gold = getTreasureGold();
+    player->addGold(gold);
+    Serial.println("Found " + String(gold) + " gold");
+    
+    looted = true;
     setCompleted(true);
+    return kept;
 }
 
-// Open shop for player
-void Room::openShop(Player* player) {
-    if (shopVisited) {
-        Serial.println("The shopkeeper has already sold you everything!");
-        return;
+int Room::getTreasureGold() const {
+    return treasureValue * TREASURE_GOLD_PER_VALUE;
+}
+
+// Roll the enemy (or boss) drop after a won fight
+LootDrop Room::giveCombatLoot(Player* player) {
+    LootSource source = (type == ROOM_BOSS) ? LOOT_BOSS : (LootSource)EnemyArchetypes::get(enemyTypeID).lootSource;
+    LootDrop drop = LootTables::roll(source, floorNumber, RngService::get(RNG_LOOT));
+    
+    if (!applyLoot(player, drop)) {
+        LootDrop none = {ITEM_ID_NONE, 0};
+        return none;
     }
+    player->refreshStats();
+    Serial.println(String("Enemy dropped ") + String(drop.quantity) + "x " + ItemCatalog::getName(drop.itemID));
+    return drop;
+}
+
+// Shop
+void Room::generateShop(uint32_t seed) {
+    ShopGen::generate(shop, floorNumber, seed);
+}
+
+const ShopStock& Room::getShop() const {
+    return shop;
+}
+
+PurchaseResult Room::buyFromShop(Player* player, int slotIndex) {
+    if (slotIndex < 0 || slotIndex >= shop.slotCount) return PURCHASE_INVALID;
     
-    // For testing, give free gear
-    player->addEquipmentBonus(0, 5, 3, 0);
-    Serial.println("Shop: You received Warrior's Gear! (+5 ATK, +3 DEF)");
+    ShopSlot& slot = shop.slots[slotIndex];
+    if (slot.stock == 0) {
+        Serial.println("Shop: Sold out!");
+        return PURCHASE_SOLD_OUT;
+    }
     
-    shopVisited = true;
-    setCompleted(true);
+    // Check room before charging, so a full pack costs nothing
+    if (!player->getInventory().hasSpace(slot.itemID)) {
+        Serial.println("Shop: Inventory full!");
+        return PURCHASE_NO_ROOM;
+    }
+    
+    int price = slot.price;
+    if (!player->spendGold(price)) {
+        Serial.println("Shop: Not enough gold!");
+        return PURCHASE_NO_GOLD;
+    }
+    
+    LootDrop bought = {slot.itemID, 1};
+    applyLoot(player, bought);
+    ShopGen::recordPurchase(shop, slotIndex);
+    player->refreshStats();
+    Serial.println(String("Shop: Bought ") + ItemCatalog::getName(slot.itemID) + " for " + String(price) + " gold");
+    return PURCHASE_OK;
+}
+
+// Units of an item across all slots (gear copies each take their own slot)
+static int countCopies(const Inventory& inventory, int itemID) {
+    int count = 0;
+    for (const InventorySlot& slot : inventory.getItems()) {
+        if (slot.itemID == itemID) count += slot.quantity;
+    }
+    return count;
+}
+
+// Sell one unit of any inventory item. Worn gear can only go if a spare
+// copy is left to wear, so selling never changes the player's stats.
+SaleResult Room::sellToShop(Player* player, int itemID) {
+    Inventory& inventory = player->getInventory();
+    int copies = countCopies(inventory, itemID);
+    if (copies <= 0) return SALE_INVALID;
+    
+    if (inventory.isEquipped(itemID) && copies <= 1) {
+        Serial.println("Shop: Unequip that first!");
+        return SALE_EQUIPPED;
+    }
+    
+    int price = ShopGen::getSellPrice(shop, itemID);
+    if (!inventory.removeItem(itemID, 1)) return SALE_INVALID;
+    player->addGold(price);
+    ShopGen::recordSale(shop);
+    Serial.println(String("Shop: Sold ") + ItemCatalog::getName(itemID) + " for " + String(price) + " gold");
+    return SALE_OK;
 }
 
 // Get door icon for this room type
@@ -100,35 +217,13 @@ DoorIcon Room::getDoorIcon() const {
 }
 
 // Get room description
-String Room::getDescription() const {
-    switch(type) {
-        case ROOM_ENEMY:
-            return "Growling echoes within";
-        case ROOM_TREASURE:
-            return "Something glints inside";
-        case ROOM_SHOP:
-            return "You smell incense";
-        case ROOM_BOSS:
-            return "Ominous presence lurks";
-        default:
-            return "Mysterious room";
-    }
+const char* Room::getDescription() const {
+    return NameTables::getRoomDescription(type);
 }
 
 // Get room name
-String Room::getRoomName() const {
-    switch(type) {
-        case ROOM_ENEMY:
-            return "Combat Room";
-        case ROOM_TREASURE:
-            return "Treasure Room";
-        case ROOM_SHOP:
-            return "Shop";
-        case ROOM_BOSS:
-            return "Boss Chamber";
-        default:
-            return "Unknown Room";
-    }
+const char* Room::getRoomName() const {
+    return NameTables::getRoomName(type);
 }
 
 // Setup methods
@@ -3,6 +3,8 @@
 
 #include "../entities/player.h"
 #include "../entities/enemy.h"
+#include "../item/loot_tables.h"
+#include "../item/shop.h"
 #include <Arduino.h>
 
 enum RoomType {
@@ -12,6 +14,22 @@ enum RoomType {
     ROOM_BOSS
 };
 
+// Outcome of Room::buyFromShop
+enum PurchaseResult {
+    PURCHASE_OK,
+    PURCHASE_SOLD_OUT,
+    PURCHASE_NO_GOLD,
+    PURCHASE_NO_ROOM,     // Inventory full - nothing charged
+    PURCHASE_INVALID
+};
+
+// Outcome of Room::sellToShop
+enum SaleResult {
+    SALE_OK,
+    SALE_EQUIPPED,        // Last copy is worn - unequip it first
+    SALE_INVALID          // Not in the inventory
+};
+
 enum DoorIcon {
     ICON_SWORD,        // Enemy room
     ICON_QUESTION,     // Treasure or Shop
@@ -23,36 +41,56 @@ private:
     int roomID;
     RoomType type;
     bool completed;
+    bool visited;
+    bool looted;      // Treasure (chest) taken
+    int floorNumber;
     
     // Enemy rooms
     int enemyTypeID;
     
     // Treasure rooms
-    int treasureType;
-    int treasureValue;
+    int treasureType;    // Number of loot rolls (1-3)
+    int treasureValue;   // Scales the gold found
     
-    // Shop rooms
-    bool shopVisited;
+    // Shop rooms (stock is built with the room, not when the shop opens)
+    ShopStock shop;
     
 public:
     // Constructor
+    Room();
     Room(int id, RoomType roomType);
     
+    // Reinitialize a pooled room in place
+    void reset(int id, RoomType roomType);
+    
     // Room properties
     RoomType getType() const;
     int getRoomID() const;
     bool isCompleted() const;
     void setCompleted(bool complete);
+    bool isVisited() const;
+    void setVisited(bool hasVisited);
+    bool isLooted() const;
+    void setLooted(bool hasLooted);
+    int getFloorNumber() const;
+    void setFloorNumber(int floor);
     
     // Room content
-    Enemy createEnemy() const;
-    void giveTreasure(Player* player);
-    void openShop(Player* player);
+    void spawnEnemy(Enemy& enemy) const;  // In place, from the enemy archetype
+    int giveTreasure(Player* player, LootDrop* found, int maxFound);  // Returns drops the player kept
+    int getTreasureGold() const;
+    LootDrop giveCombatLoot(Player* player);  // ITEM_ID_NONE unless the drop was kept
+    
+    // Shop
+    void generateShop(uint32_t seed);
+    const ShopStock& getShop() const;
+    PurchaseResult buyFromShop(Player* player, int slotIndex);
+    SaleResult sellToShop(Player* player, int itemID);  // One unit
     
     // Display
     DoorIcon getDoorIcon() const;
-    String getDescription() const;
-    String getRoomName() const;
+    const char* getDescription() const;
+    const char* getRoomName() const;
     
     // Room setup
     void setEnemyType(int enemyID);
@@ -0,0 +1,179 @@
+#include "floor_graph.h"
+#include "../entities/enemy_archetypes.h"
+#include <string.h>
+
+// Keeps floor seeds apart from the RngService stream seeds
+static const uint32_t FLOOR_SEED_SALT = 0x1000;
+
+uint32_t FloorGraphGen::floorSeed(uint32_t runSeed, int floorNumber) {
+    return RngService::deriveSeed(runSeed, FLOOR_SEED_SALT + (uint32_t)floorNumber);
+}
+
+int FloorGraphGen::rollNodeType(Rng& rng) {
+    int roll = rng.range(1, 101); // 1-100
+    
+    if (roll <= 60) {
+        return NODE_ENEMY;
+    } else if (roll <= 85) {
+        return NODE_TREASURE;
+    } else {
+        return NODE_SHOP;
+    }
+}
+
+// Layered DAG: room s of a layer always leads to room s (or the last room)
+// of the next layer, and usually to room s + 1 too. The last room of a layer
+// always fans out when the next layer is wider, so every room is reachable.
+// The last layer converges on the boss.
+void FloorGraphGen::generate(FloorGraph& graph, int floorNumber, uint32_t seed) {
+    memset(&graph, 0, sizeof(FloorGraph));
+    graph.seed = seed;
+    graph.floorNumber = (uint8_t)floorNumber;
+    
+    Rng rng(seed);
+    
+    // Layer widths (entrance has two doors, so the first layer is always 2)
+    uint8_t layerStart[FLOOR_GRAPH_LAYERS + 1];
+    int count = 1;
+    for (int layer = 0; layer < FLOOR_GRAPH_LAYERS; layer++) {
+        int width = (layer == 0) ? FLOOR_GRAPH_MIN_WIDTH :
+                    rng.range(FLOOR_GRAPH_MIN_WIDTH, FLOOR_GRAPH_MAX_WIDTH + 1);
+        graph.layerWidth[layer] = (uint8_t)width;
+        layerStart[layer] = (uint8_t)count;
+        count += width;
+    }
+    layerStart[FLOOR_GRAPH_LAYERS] = (uint8_t)count;
+    
+    // Boss room (a sink)
+    graph.nodes[FLOOR_BOSS_NODE] = packNode(NODE_BOSS, ENEMY_ID_BOSS, 0, 0, FLOOR_GRAPH_LAYERS, 0);
+    graph.edgeStart[FLOOR_BOSS_NODE] = 0;
+    graph.edgeStart[FLOOR_BOSS_NODE + 1] = 0;
+    
+    // Rooms and their out-edges, in index order (CSR is filled as we go)
+    int edgeCount = 0;
+    for (int layer = 0; layer < FLOOR_GRAPH_LAYERS; layer++) {
+        int width = graph.layerWidth[layer];
+        bool lastLayer = (layer == FLOOR_GRAPH_LAYERS - 1);
+        int nextWidth = lastLayer ? 1 : graph.layerWidth[layer + 1];
+        
+        for (int slot = 0; slot < width; slot++) {
+            int index = layerStart[layer] + slot;
+            int type = rollNodeType(rng);
+            int enemyID = 0;
+            int treasureType = 0;
+            int treasureValue = 0;
+            
+            if (type == NODE_ENEMY) {
+                enemyID = EnemyArchetypes::rollType(rng);
+            } else if (type == NODE_TREASURE) {
+                treasureType = rng.range(1, 4);
+                treasureValue = floorNumber + rng.range(1, 4);
+                if (treasureValue > 255) treasureValue = 255;
+            }
+            graph.nodes[index] = packNode(type, enemyID, treasureType, treasureValue, layer, slot);
+            
+            if (lastLayer) {
+                graph.edges[edgeCount++] = FLOOR_BOSS_NODE;
+            } else {
+                int nextStart = layerStart[layer + 1];
+                int first = (slot < nextWidth) ? slot : nextWidth - 1;
+                graph.edges[edgeCount++] = (uint8_t)(nextStart + first);
+                
+                bool mustFanOut = (slot == width - 1) && (nextWidth > width);
+                bool canFanOut = (slot + 1 < nextWidth);
+                if (canFanOut && (mustFanOut || rng.chance(60))) {
+                    graph.edges[edgeCount++] = (uint8_t)(nextStart + slot + 1);
+                }
+            }
+            graph.edgeStart[index + 1] = (uint8_t)edgeCount;
+        }
+    }
+    
+    graph.nodeCount = (uint8_t)count;
+    graph.edgeCount = (uint8_t)edgeCount;
+    graph.entryCount = graph.layerWidth[0];
+    for (int i = 0; i < graph.entryCount; i++) {
+        graph.entry[i] = (uint8_t)(layerStart[0] + i);
+    }
+}
+
+uint32_t FloorGraphGen::packNode(int type, int enemyID, int treasureType, int treasureValue,
+                                 int layer, int slot) {
+    return ((uint32_t)type & 0x3) |
+           (((uint32_t)enemyID & FLOOR_NODE_ENEMY_MASK) << 2) |
+           (((uint32_t)treasureType & 0x3) << 6) |
+           (((uint32_t)treasureValue & 0xFF) << 8) |
+           (((uint32_t)layer & 0xF) << 16) |
+           (((uint32_t)slot & 0x3) << 20);
+}
+
+int FloorGraphGen::getType(uint32_t node) {
+    return node & 0x3;
+}
+
+int FloorGraphGen::getEnemyID(uint32_t node) {
+    return (node >> 2) & FLOOR_NODE_ENEMY_MASK;
+}
+
+int FloorGraphGen::getTreasureType(uint32_t node) {
+    return (node >> 6) & 0x3;
+}
+
+int FloorGraphGen::getTreasureValue(uint32_t node) {
+    return (node >> 8) & 0xFF;
+}
+
+int FloorGraphGen::getLayer(uint32_t node) {
+    return (node >> 16) & 0xF;
+}
+
+int FloorGraphGen::getSlot(uint32_t node) {
+    return (node >> 20) & 0x3;
+}
+
+int FloorGraphGen::getOutDegree(const FloorGraph& graph, int node) {
+    return graph.edgeStart[node + 1] - graph.edgeStart[node];
+}
+
+uint8_t FloorGraphGen::getSuccessor(const FloorGraph& graph, int node, int index) {
+    return graph.edges[graph.edgeStart[node] + index];
+}
+
+// Rooms are stored in layer order, so walking indices backwards visits every
+// room after all of its successors (the boss, index 0, is the base case).
+void FloorGraphGen::analyzeRoutes(const FloorGraph& graph, FloorRoutes& routes) {
+    routes.maxTreasure[FLOOR_BOSS_NODE] = 0;
+    routes.minFights[FLOOR_BOSS_NODE] = 1;
+    
+    for (int i = graph.nodeCount - 1; i > FLOOR_BOSS_NODE; i--) {
+        int type = getType(graph.nodes[i]);
+        uint8_t bestTreasure = 0;
+        uint8_t fewestFights = 0xFF;
+        
+        for (int e = graph.edgeStart[i]; e < graph.edgeStart[i + 1]; e++) {
+            uint8_t next = graph.edges[e];
+            if (routes.maxTreasure[next] > bestTreasure) bestTreasure = routes.maxTreasure[next];
+            if (routes.minFights[next] < fewestFights) fewestFights = routes.minFights[next];
+        }
+        
+        routes.maxTreasure[i] = bestTreasure + (type == NODE_TREASURE ? 1 : 0);
+        routes.minFights[i] = fewestFights + (type == NODE_ENEMY ? 1 : 0);
+    }
+}
+
+// FNV-1a over the nodes and edges actually used
+uint32_t FloorGraphGen::hash(const FloorGraph& graph) {
+    uint32_t h = 2166136261u;
+    for (int i = 0; i < graph.nodeCount; i++) {
+        uint32_t node = graph.nodes[i];
+        for (int b = 0; b < 4; b++) {
+            h ^= (node >> (b * 8)) & 0xFF;
+            h *= 16777619u;
+        }
+    }
+    for (int i = 0; i < graph.edgeCount; i++) {
+        h ^= graph.edges[i];
+        h *= 16777619u;
+    }
+    return h;
+}
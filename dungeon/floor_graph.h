@@ -0,0 +1,93 @@
+#ifndef FLOOR_GRAPH_H
+#define FLOOR_GRAPH_H
+
+#include <stdint.h>
+#include "../utils/rng.h"
+#include "../utils/name_tables.h"
+
+// Floor shape: layers of rooms branching out and converging on the boss
+static const int FLOOR_GRAPH_LAYERS = 3;        // Rooms cleared before the boss
+static const int FLOOR_GRAPH_MIN_WIDTH = 2;     // Rooms per layer
+static const int FLOOR_GRAPH_MAX_WIDTH = 3;
+static const int FLOOR_GRAPH_MAX_NODES = 32;
+static const int FLOOR_GRAPH_MAX_EDGES = 64;
+static const int FLOOR_NODE_LINKS = 2;          // Max out-degree (two doors)
+static const uint8_t FLOOR_NODE_NONE = 0xFF;
+static const uint8_t FLOOR_BOSS_NODE = 0;
+static const int FLOOR_NODE_ENEMY_BITS = 4;     // Enemy type IDs up to 15
+static const uint32_t FLOOR_NODE_ENEMY_MASK = (1u << FLOOR_NODE_ENEMY_BITS) - 1;
+
+static_assert(ENEMY_ID_COUNT <= (1 << FLOOR_NODE_ENEMY_BITS),
+              "Widen the enemy ID field of a floor node");
+
+// Node types (same order as RoomType)
+enum FloorNodeType {
+    NODE_ENEMY = 0,
+    NODE_TREASURE = 1,
+    NODE_SHOP = 2,
+    NODE_BOSS = 3
+};
+
+// A whole floor, generated up front from a seed.
+// One 32-bit word per room:
+//   bits 0-1   type            bits 2-5   enemy type ID
+//   bits 6-7   treasure type   bits 8-15  treasure value
+//   bits 16-19 layer           bits 20-21 slot in layer
+// Links are stored as compressed adjacency (CSR): the successors of node i
+// are edges[edgeStart[i] .. edgeStart[i + 1]). Node 0 is the boss; rooms
+// follow in layer order, so every edge goes from a lower to a higher index
+// (or to the boss). The entrance is not a room - its doors live in entry[].
+struct FloorGraph {
+    uint32_t nodes[FLOOR_GRAPH_MAX_NODES];
+    uint8_t edgeStart[FLOOR_GRAPH_MAX_NODES + 1];
+    uint8_t edges[FLOOR_GRAPH_MAX_EDGES];
+    uint8_t layerWidth[FLOOR_GRAPH_LAYERS];
+    uint8_t entry[FLOOR_NODE_LINKS];
+    uint32_t seed;
+    uint8_t nodeCount;
+    uint8_t edgeCount;
+    uint8_t entryCount;
+    uint8_t floorNumber;
+};
+
+// Best routes from each room to the boss (room itself and boss included)
+struct FloorRoutes {
+    uint8_t maxTreasure[FLOOR_GRAPH_MAX_NODES];  // Most treasure rooms on any route
+    uint8_t minFights[FLOOR_GRAPH_MAX_NODES];    // Fewest fights on any route
+};
+
+// Single-pass, allocation-free floor generator. Integer-only and driven by
+// its own Rng, so a seed gives the same floor on the ESP32 and on a host.
+class FloorGraphGen {
+public:
+    // Per-floor seed derived from the run seed
+    static uint32_t floorSeed(uint32_t runSeed, int floorNumber);
+    
+    // Build the whole floor
+    static void generate(FloorGraph& graph, int floorNumber, uint32_t seed);
+    
+    // Node packing
+    static uint32_t packNode(int type, int enemyID, int treasureType, int treasureValue,
+                             int layer, int slot);
+    static int getType(uint32_t node);
+    static int getEnemyID(uint32_t node);
+    static int getTreasureType(uint32_t node);
+    static int getTreasureValue(uint32_t node);
+    static int getLayer(uint32_t node);
+    static int getSlot(uint32_t node);
+    
+    // Adjacency
+    static int getOutDegree(const FloorGraph& graph, int node);
+    static uint8_t getSuccessor(const FloorGraph& graph, int node, int index);
+    
+    // Route DP over the DAG in reverse topological order - O(nodes + edges)
+    static void analyzeRoutes(const FloorGraph& graph, FloorRoutes& routes);
+    
+    // Fingerprint of a generated floor (for determinism checks)
+    static uint32_t hash(const FloorGraph& graph);
+    
+private:
+    static int rollNodeType(Rng& rng);
+};
+
+#endif
@@ -0,0 +1,64 @@
+#include "run_state.h"
+#include <string.h>
+#include <stddef.h>
+
+static const uint32_t FNV_OFFSET = 2166136261u;
+static const uint32_t FNV_PRIME = 16777619u;
+
+static uint32_t fnv(uint32_t h, const uint8_t* bytes, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        h ^= bytes[i];
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+void RunState::clear(DungeonRunState& state) {
+    memset(&state, 0, sizeof(DungeonRunState));
+    state.version = RUN_STATE_VERSION;
+    state.size = (uint16_t)sizeof(DungeonRunState);
+    state.currentNode = FLOOR_NODE_NONE;
+    state.enteredNode = FLOOR_NODE_NONE;
+}
+
+bool RunState::isValid(const DungeonRunState& state) {
+    return state.version == RUN_STATE_VERSION &&
+           state.size == sizeof(DungeonRunState) &&
+           state.roomCount <= FLOOR_GRAPH_MAX_NODES;
+}
+
+int RunState::getRoomType(const DungeonRunState& state, int room) {
+    return (state.roomTypes[room >> 4] >> ((room & 15) * 2)) & 0x3;
+}
+
+void RunState::setRoomType(DungeonRunState& state, int room, int type) {
+    int shift = (room & 15) * 2;
+    uint32_t& word = state.roomTypes[room >> 4];
+    word = (word & ~(0x3u << shift)) | ((uint32_t)(type & 0x3) << shift);
+}
+
+bool RunState::getFlag(uint32_t mask, int room) {
+    return (mask >> room) & 1u;
+}
+
+void RunState::setFlag(uint32_t& mask, int room, bool value) {
+    if (value) {
+        mask |= (1u << room);
+    } else {
+        mask &= ~(1u << room);
+    }
+}
+
+uint32_t RunState::hash(const DungeonRunState& state) {
+    return fnv(FNV_OFFSET, (const uint8_t*)&state, sizeof(DungeonRunState));
+}
+
+// Everything except the RNG streams (the fields either side of rngState)
+uint32_t RunState::hashProgress(const DungeonRunState& state) {
+    const uint8_t* bytes = (const uint8_t*)&state;
+    size_t rngStart = offsetof(DungeonRunState, rngState);
+    size_t rngEnd = rngStart + sizeof(state.rngState);
+    
+    uint32_t h = fnv(FNV_OFFSET, bytes, rngStart);
+    return fnv(h, bytes + rngEnd, sizeof(DungeonRunState) - rngEnd);
+}
@@ -0,0 +1,64 @@
+#ifndef RUN_STATE_H
+#define RUN_STATE_H
+
+#include <stdint.h>
+#include <type_traits>
+#include "floor_graph.h"
+#include "../utils/rng.h"
+
+static const uint16_t RUN_STATE_VERSION = 1;
+static const int RUN_STATE_FLASH_PAGE = 256;   // ESP32 flash program page
+
+// The whole dungeon run in a few dozen bytes, as plain data.
+// The floor layout itself is not stored: it is rebuilt from floorSeed,
+// so only what the player changed is kept.
+//   roomTypes      2 bits per room (RoomType), room i = graph node i
+//   completedMask  bit i set = room i cleared
+//   visitedMask    bit i set = room i entered
+//   lootedMask     bit i set = room i's treasure taken
+// Shop stock is regenerated with the floor.
+struct DungeonRunState {
+    uint16_t version;
+    uint16_t size;
+    uint32_t runSeed;
+    uint32_t floorSeed;
+    uint32_t roomTypes[2];
+    uint32_t completedMask;
+    uint32_t visitedMask;
+    uint32_t lootedMask;
+    uint32_t rngState[RNG_STREAM_COUNT][4];
+    uint16_t totalRoomsCompleted;
+    uint8_t floorNumber;
+    uint8_t roomCount;
+    uint8_t roomsCompleted;
+    uint8_t currentNode;   // Last room cleared (FLOOR_NODE_NONE = entrance)
+    uint8_t enteredNode;   // Room being played (FLOOR_NODE_NONE = choosing doors)
+    uint8_t reserved;
+};
+
+static_assert(std::is_trivially_copyable<DungeonRunState>::value, "DungeonRunState must stay POD");
+static_assert(sizeof(DungeonRunState) <= RUN_STATE_FLASH_PAGE, "DungeonRunState must fit one flash page");
+static_assert(FLOOR_GRAPH_MAX_NODES <= 32, "Room masks hold 32 rooms");
+
+// Accessors and hashing for DungeonRunState (no Arduino, usable in host tools)
+class RunState {
+public:
+    // Zero everything and stamp version/size
+    static void clear(DungeonRunState& state);
+    static bool isValid(const DungeonRunState& state);
+    
+    // Per-room fields
+    static int getRoomType(const DungeonRunState& state, int room);
+    static void setRoomType(DungeonRunState& state, int room, int type);
+    static bool getFlag(uint32_t mask, int room);
+    static void setFlag(uint32_t& mask, int room, bool value);
+    
+    // FNV-1a over the whole state (same state = same hash)
+    static uint32_t hash(const DungeonRunState& state);
+    
+    // Hash of dungeon progress only (ignores RNG streams), for deduping
+    // states that differ only in upcoming random rolls
+    static uint32_t hashProgress(const DungeonRunState& state);
+};
+
+#endif
@@ -1,47 +1,37 @@
 #include "enemy.h"
 #include "../utils/constants.h"
+#include "../utils/rng.h"
+#include "../combat/combat_rules.h"
 
 // Default constructor
-Enemy::Enemy() : Entity("Unknown Enemy", 20, 8, 4, 6) {
-    aiType = AI_BALANCED;
-    spriteFile = "enemies/default.bmp";
-    experienceValue = 10;
+Enemy::Enemy() {
+    spawn(ENEMY_ID_UNKNOWN);
 }
 
-// Basic constructor
-Enemy::Enemy(String enemyName, int hp, int atk, int spd) 
-    : Entity(enemyName, hp, atk, 4, spd) {  // Default defense of 4
-    aiType = AI_BALANCED;
-    spriteFile = "enemies/" + enemyName + ".bmp";
-    experienceValue = (hp + atk + spd) / 3; // Simple exp calculation
+Enemy::Enemy(uint8_t typeID, int floorNumber) {
+    spawn(typeID, floorNumber);
 }
 
-// Full constructor with AI type
-Enemy::Enemy(String enemyName, int hp, int atk, int spd, AIType ai) 
-    : Entity(enemyName, hp, atk, 4, spd) {  // Default defense of 4
-    aiType = ai;
-    spriteFile = "enemies/" + enemyName + ".bmp";
-    experienceValue = (hp + atk + spd) / 3;
+// Everything comes from two table rows: the archetype (AI, sprite, loot)
+// and the floor's stat block - no per-type code
+void Enemy::spawn(uint8_t typeID, int floorNumber) {
+    if (!EnemyArchetypes::isValid(typeID)) typeID = ENEMY_ID_UNKNOWN;
+    const EnemyArchetype& archetype = EnemyArchetypes::get(typeID);
+    
+    enemyTypeID = typeID;
+    nameID = typeID;
+    aiType = (AIType)archetype.aiType;
+    resetDefense();
+    applyStatBlock(EnemyCurves::getStats(typeID, floorNumber));
+}
+
+void Enemy::spawnRandom(int floorNumber) {
+    spawn(EnemyArchetypes::rollType(RngService::get(RNG_DUNGEON)), floorNumber);
 }
 
-// AI Decision Making
+// AI Decision Making (odds live in CombatRules, shared with the simulators)
 EnemyAction Enemy::chooseAction() {
-    int roll = random(1, 101); // Random number 1-100
-    
-    switch(aiType) {
-        case AI_AGGRESSIVE:
-            return (roll <= 80) ? ENEMY_ATTACK : ENEMY_DEFEND;
-            
-        case AI_DEFENSIVE:
-            return (roll <= 40) ? ENEMY_ATTACK : ENEMY_DEFEND;
-            
-        case AI_BERSERKER:
-            return (roll <= 90) ? ENEMY_ATTACK : ENEMY_DEFEND;
-            
-        case AI_BALANCED:
-        default:
-            return (roll <= 60) ? ENEMY_ATTACK : ENEMY_DEFEND;
-    }
+    return CombatRules::chooseEnemyAction(aiType, RngService::get(RNG_COMBAT));
 }
 
 // Combat Actions with AI-specific modifiers
@@ -96,12 +86,16 @@ AIType Enemy::getAIType() const {
     return aiType;
 }
 
-void Enemy::setSpriteFile(String filename) {
-    spriteFile = filename;
+uint8_t Enemy::getEnemyTypeID() const {
+    return enemyTypeID;
+}
+
+const EnemyArchetype& Enemy::getArchetype() const {
+    return EnemyArchetypes::get(enemyTypeID);
 }
 
-String Enemy::getSpriteFile() const {
-    return spriteFile;
+const char* Enemy::getSpriteFile() const {
+    return NameTables::getEnemySprite(getArchetype().spriteID);
 }
 
 void Enemy::setExperienceValue(int exp) {
@@ -112,47 +106,16 @@ int Enemy::getExperienceValue() const {
     return experienceValue;
 }
 
-// Simple Enemy Factory Methods
-Enemy Enemy::createGoblin() {
-    Enemy goblin("Goblin", GOBLIN_HP, GOBLIN_ATK, GOBLIN_SPD, AI_AGGRESSIVE);
-    goblin.defense = GOBLIN_DEF;  // Set defense using constant
-    goblin.setSpriteFile("enemies/goblin.bmp");
-    goblin.setExperienceValue(15);
-    return goblin;
-}
-
-Enemy Enemy::createSkeleton() {
-    Enemy skeleton("Skeleton", SKELETON_HP, SKELETON_ATK, SKELETON_SPD, AI_DEFENSIVE);
-    skeleton.defense = SKELETON_DEF;  // Set defense using constant
-    skeleton.setSpriteFile("enemies/skeleton.bmp");
-    skeleton.setExperienceValue(25);
-    return skeleton;
+void Enemy::setGoldValue(int gold) {
+    goldValue = gold;
 }
 
-Enemy Enemy::createOrc() {
-    Enemy orc("Orc Warrior", ORC_HP, ORC_ATK, ORC_SPD, AI_BERSERKER);
-    orc.defense = ORC_DEF;  // Set defense using constant
-    orc.setSpriteFile("enemies/orc.bmp");
-    orc.setExperienceValue(40);
-    return orc;
-}
-
-Enemy Enemy::createRandomEnemy() {
-    int enemyType = random(1, 4); // Random 1-3
-    
-    switch(enemyType) {
-        case 1:
-            return createGoblin();
-        case 2:
-            return createSkeleton();
-        case 3:
-            return createOrc();
-        default:
-            return createGoblin(); // Fallback
-    }
+int Enemy::getGoldValue() const {
+    return goldValue;
 }
 
-// Destructor
-Enemy::~Enemy() {
-    // Nothing special to clean up
+void Enemy::applyStatBlock(const EnemyStatBlock& stats) {
+    setStats(stats.hp, stats.attack, stats.defense, stats.speed);
+    experienceValue = stats.experience;
+    goldValue = stats.gold;
 }
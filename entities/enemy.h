@@ -2,56 +2,52 @@
 #define ENEMY_H
 
 #include "entity.h"
+#include "../combat/combat_types.h"
+#include "../utils/name_tables.h"
+#include "enemy_curves.h"
+#include "enemy_archetypes.h"
 #include <Arduino.h>
 
-enum AIType {
-    AI_AGGRESSIVE,   // Always attacks (80% attack, 20% defend)
-    AI_DEFENSIVE,    // Prefers to defend (40% attack, 60% defend)
-    AI_BALANCED,     // Mix of attack/defend (60% attack, 40% defend)
-    AI_BERSERKER     // High damage, risky (90% attack, 10% defend)
-};
-
-enum EnemyAction {
-    ENEMY_ATTACK = 0,
-    ENEMY_DEFEND = 1
-};
-
 class Enemy : public Entity {
 private:
     AIType aiType;
-    String spriteFile;
+    uint8_t enemyTypeID;  // Name ID and sprite key (NameTables)
     int experienceValue;
+    int goldValue;
     
 public:
     // Constructors
-    Enemy();
-    Enemy(String enemyName, int hp, int atk, int spd);
-    Enemy(String enemyName, int hp, int atk, int spd, AIType ai);
+    Enemy();  // Unknown archetype, floor 1
+    Enemy(uint8_t typeID, int floorNumber = 1);
+    
+    // Rebuild this enemy in place from its archetype, scaled to the floor
+    void spawn(uint8_t typeID, int floorNumber = 1);
+    void spawnRandom(int floorNumber = 1);  // Random real enemy type (dungeon RNG)
     
     // AI behavior
     EnemyAction chooseAction();
     void setAIType(AIType type);
     AIType getAIType() const;
     
-    // Sprite management
-    void setSpriteFile(String filename);
-    String getSpriteFile() const;
+    // Type (archetype index; name and sprite come from NameTables)
+    uint8_t getEnemyTypeID() const;
+    const EnemyArchetype& getArchetype() const;
+    const char* getSpriteFile() const;
     
-    // Experience/rewards (for future leveling system)
+    // Experience/rewards
     void setExperienceValue(int exp);
     int getExperienceValue() const;
+    void setGoldValue(int gold);
+    int getGoldValue() const;
     
-    // Combat actions (override parent for AI-specific behavior)
-    int performAttack() override;
-    int performDefend() override;
-    
-    // Simple enemy factory (we'll expand this later)
-    static Enemy createGoblin();
-    static Enemy createSkeleton();
-    static Enemy createOrc();
-    static Enemy createRandomEnemy();
+    // Floor scaling (stats and rewards from EnemyCurves)
+    void applyStatBlock(const EnemyStatBlock& stats);
     
-    virtual ~Enemy();
+    // Combat actions (AI-specific versions of the Entity ones)
+    int performAttack();
+    int performDefend();
 };
 
+static_assert(std::is_trivially_copyable<Enemy>::value, "Enemy must stay plain data (copied by value per fight)");
+
 #endif
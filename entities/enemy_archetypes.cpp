@@ -0,0 +1,28 @@
+#include "enemy_archetypes.h"
+
+static_assert(sizeof(ENEMY_ARCHETYPES) / sizeof(ENEMY_ARCHETYPES[0]) == ENEMY_ID_COUNT,
+              "Add an archetype row for every enemy type");
+
+// Every row must point at its own sprite and a loot table that exists
+static constexpr bool rowsValid(int id) {
+    return id >= ENEMY_ID_COUNT ||
+           (ENEMY_ARCHETYPES[id].spriteID < ENEMY_ID_COUNT &&
+            ENEMY_ARCHETYPES[id].lootSource < LOOT_SOURCE_COUNT &&
+            ENEMY_ARCHETYPES[id].aiType <= AI_BERSERKER &&
+            ENEMY_ARCHETYPES[id].hp > 0 &&
+            rowsValid(id + 1));
+}
+static_assert(rowsValid(0), "Enemy archetype rows must reference valid sprites, loot tables and AI types");
+
+bool EnemyArchetypes::isValid(int enemyID) {
+    return enemyID >= 0 && enemyID < ENEMY_ID_COUNT;
+}
+
+const EnemyArchetype& EnemyArchetypes::get(int enemyID) {
+    if (!isValid(enemyID)) enemyID = ENEMY_ID_UNKNOWN;
+    return ENEMY_ARCHETYPES[enemyID];
+}
+
+uint8_t EnemyArchetypes::rollType(Rng& rng) {
+    return (uint8_t)rng.range(1, ENEMY_ID_COUNT);
+}
@@ -0,0 +1,50 @@
+#ifndef ENEMY_ARCHETYPES_H
+#define ENEMY_ARCHETYPES_H
+
+#include <stdint.h>
+#include "../combat/combat_types.h"
+#include "../item/loot_tables.h"
+#include "../utils/constants.h"
+#include "../utils/name_tables.h"
+#include "../utils/rng.h"
+
+// Everything that defines an enemy type on floor 1. Name and sprite text
+// live in NameTables; the archetype only holds their IDs.
+struct EnemyArchetype {
+    uint16_t hp;
+    uint8_t attack;
+    uint8_t defense;
+    uint8_t speed;
+    uint8_t aiType;      // AIType
+    uint8_t spriteID;    // NameTables::getEnemySprite key
+    uint8_t lootSource;  // LootSource rolled after a win (boss rooms roll LOOT_BOSS)
+    uint16_t experience;
+    uint16_t gold;
+};
+
+// Indexed by enemy type ID. Kept in the header as constexpr data so the
+// difficulty curves and host tools build their tables from it at compile
+// time; adding an enemy type is a new row here plus its growth row in
+// EnemyCurves and its name/sprite in NameTables.
+static constexpr EnemyArchetype ENEMY_ARCHETYPES[ENEMY_ID_COUNT] = {
+    // Unknown (fallback)
+    {20,          8,            4,            6,            AI_BALANCED,   ENEMY_ID_UNKNOWN,  LOOT_ENEMY, 10, 3},
+    {GOBLIN_HP,   GOBLIN_ATK,   GOBLIN_DEF,   GOBLIN_SPD,   AI_AGGRESSIVE, ENEMY_ID_GOBLIN,   LOOT_ENEMY, 15, 5},
+    {SKELETON_HP, SKELETON_ATK, SKELETON_DEF, SKELETON_SPD, AI_DEFENSIVE,  ENEMY_ID_SKELETON, LOOT_ENEMY, 25, 8},
+    {ORC_HP,      ORC_ATK,      ORC_DEF,      ORC_SPD,      AI_BERSERKER,  ENEMY_ID_ORC,      LOOT_ENEMY, 40, 12}
+};
+
+// Archetype behind every floor's boss room
+static const uint8_t ENEMY_ID_BOSS = ENEMY_ID_ORC;
+
+class EnemyArchetypes {
+public:
+    // Unknown IDs get the ENEMY_ID_UNKNOWN row
+    static const EnemyArchetype& get(int enemyID);
+    static bool isValid(int enemyID);
+    
+    // Uniform pick over the real enemy types (IDs 1..ENEMY_ID_COUNT-1)
+    static uint8_t rollType(Rng& rng);
+};
+
+#endif
@@ -0,0 +1,63 @@
+#include "enemy_curves.h"
+#include "enemy_archetypes.h"
+#include "../utils/constants.h"
+
+// Growth per floor (percent of the archetype's floor 1 value)
+struct EnemyGrowth {
+    int hp, attack, defense, speed, reward;
+};
+
+// Indexed by enemy type ID
+static constexpr EnemyGrowth GROWTH[ENEMY_ID_COUNT] = {
+    {10, 6, 6, 2, 15},    // Unknown
+    {10, 8, 5, 3, 15},    // Goblin: gets faster and hits harder
+    {10, 6, 10, 2, 15},   // Skeleton: armor grows fastest
+    {12, 7, 6, 1, 15}     // Orc: mostly more health
+};
+
+// Linear growth plus a small quadratic term: base * (1 + g*d*(20 + d)/2000)
+// where d = floors below the first. At d = 10 that is 1.5x the linear rate.
+static constexpr int curveValue(int base, int growthPercent, int floorNumber) {
+    return base + base * growthPercent * (floorNumber - 1) * (20 + floorNumber - 1) / 2000;
+}
+
+static constexpr EnemyStatBlock makeStats(int enemyID, int floorNumber) {
+    return EnemyStatBlock{
+        (uint16_t)curveValue(ENEMY_ARCHETYPES[enemyID].hp, GROWTH[enemyID].hp, floorNumber),
+        (uint8_t)curveValue(ENEMY_ARCHETYPES[enemyID].attack, GROWTH[enemyID].attack, floorNumber),
+        (uint8_t)curveValue(ENEMY_ARCHETYPES[enemyID].defense, GROWTH[enemyID].defense, floorNumber),
+        (uint8_t)curveValue(ENEMY_ARCHETYPES[enemyID].speed, GROWTH[enemyID].speed, floorNumber),
+        (uint16_t)curveValue(ENEMY_ARCHETYPES[enemyID].experience, GROWTH[enemyID].reward, floorNumber),
+        (uint16_t)curveValue(ENEMY_ARCHETYPES[enemyID].gold, GROWTH[enemyID].reward, floorNumber)
+    };
+}
+
+#define CURVE_ROW(id) { \
+    makeStats(id, 1),  makeStats(id, 2),  makeStats(id, 3),  makeStats(id, 4),  \
+    makeStats(id, 5),  makeStats(id, 6),  makeStats(id, 7),  makeStats(id, 8),  \
+    makeStats(id, 9),  makeStats(id, 10), makeStats(id, 11), makeStats(id, 12), \
+    makeStats(id, 13), makeStats(id, 14), makeStats(id, 15), makeStats(id, 16)  \
+}
+
+// [enemy][floor - 1], built entirely at compile time
+static constexpr EnemyStatBlock STAT_TABLE[ENEMY_ID_COUNT][DIFFICULTY_FLOORS] = {
+    CURVE_ROW(ENEMY_ID_UNKNOWN),
+    CURVE_ROW(ENEMY_ID_GOBLIN),
+    CURVE_ROW(ENEMY_ID_SKELETON),
+    CURVE_ROW(ENEMY_ID_ORC)
+};
+
+static_assert(ENEMY_ID_COUNT == 4, "Add a CURVE_ROW for every enemy type");
+static_assert(STAT_TABLE[ENEMY_ID_GOBLIN][0].hp == GOBLIN_HP &&
+              STAT_TABLE[ENEMY_ID_SKELETON][0].defense == SKELETON_DEF &&
+              STAT_TABLE[ENEMY_ID_ORC][0].attack == ORC_ATK,
+              "Floor 1 must match the enemy archetypes");
+static_assert(STAT_TABLE[ENEMY_ID_ORC][DIFFICULTY_FLOORS - 1].hp > STAT_TABLE[ENEMY_ID_ORC][0].hp,
+              "Difficulty curves must grow");
+
+const EnemyStatBlock& EnemyCurves::getStats(int enemyID, int floorNumber) {
+    if (enemyID < 0 || enemyID >= ENEMY_ID_COUNT) enemyID = ENEMY_ID_UNKNOWN;
+    if (floorNumber < 1) floorNumber = 1;
+    if (floorNumber > DIFFICULTY_FLOORS) floorNumber = DIFFICULTY_FLOORS;
+    return STAT_TABLE[enemyID][floorNumber - 1];
+}
@@ -0,0 +1,29 @@
+#ifndef ENEMY_CURVES_H
+#define ENEMY_CURVES_H
+
+#include <stdint.h>
+#include "../utils/name_tables.h"
+
+// Floors with their own row; deeper floors reuse the last one
+static const int DIFFICULTY_FLOORS = 16;
+
+// Enemy stats and rewards for one enemy type on one floor
+struct EnemyStatBlock {
+    uint16_t hp;
+    uint8_t attack;
+    uint8_t defense;
+    uint8_t speed;
+    uint16_t experience;
+    uint16_t gold;
+};
+
+// Per-floor difficulty curves. The whole [enemy][floor] table is computed
+// by the compiler from each enemy's archetype (ENEMY_ARCHETYPES) and growth
+// rates, so scaling an enemy at runtime is a single table load. Floor 1
+// matches the archetype.
+class EnemyCurves {
+public:
+    static const EnemyStatBlock& getStats(int enemyID, int floorNumber);
+};
+
+#endif
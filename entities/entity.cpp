@@ -1,9 +1,10 @@
 #include "entity.h"
 #include "../utils/constants.h"
+#include "../utils/name_tables.h"
 
 // Default constructor
 Entity::Entity() {
-    name = "Unknown";
+    nameID = ENEMY_ID_UNKNOWN;
     maxHP = 10;
     currentHP = 10;
     attack = 5;
@@ -14,8 +15,8 @@ Entity::Entity() {
 }
 
 // Constructor with parameters
-Entity::Entity(String entityName, int hp, int atk, int def, int spd) {
-    name = entityName;
+Entity::Entity(uint8_t entityNameID, int hp, int atk, int def, int spd) {
+    nameID = entityNameID;
     maxHP = hp;
     currentHP = hp;  // Start at full health
     attack = atk;
@@ -26,8 +27,12 @@ Entity::Entity(String entityName, int hp, int atk, int def, int spd) {
 }
 
 // Basic getters
-String Entity::getName() const {
-    return name;
+const char* Entity::getName() const {
+    return NameTables::getEntityName(nameID);
+}
+
+uint8_t Entity::getNameID() const {
+    return nameID;
 }
 
 int Entity::getCurrentHP() const {
@@ -47,8 +52,8 @@ int Entity::getDefense() const {
 }
 
 // Basic setters
-void Entity::setName(String newName) {
-    name = newName;
+void Entity::setNameID(uint8_t newNameID) {
+    nameID = newNameID;
 }
 
 int Entity::getSpeed() const {
@@ -64,6 +69,18 @@ void Entity::setStats(int hp, int atk, int def, int spd) {
 }
 
 // Health management
+void Entity::setCurrentHP(int hp) {
+    currentHP = hp;
+    
+    // Keep HP inside 0..maxHP
+    if (currentHP < 0) {
+        currentHP = 0;
+    }
+    if (currentHP > maxHP) {
+        currentHP = maxHP;
+    }
+}
+
 void Entity::takeDamage(int damage) {
     // Apply base defense + temporary defense
     int totalDefenseValue = defense + temporaryDefense;
@@ -130,11 +147,10 @@ void Entity::addTemporaryDefense(int defense) {
     temporaryDefense += defense;
 }
 
-int Entity::getTotalDefense() const {
-    return defense + temporaryDefense;
+int Entity::getTemporaryDefense() const {
+    return temporaryDefense;
 }
 
-// Virtual destructor
-Entity::~Entity() {
-    // Nothing to clean up for basic entity
+int Entity::getTotalDefense() const {
+    return defense + temporaryDefense;
 }
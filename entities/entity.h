@@ -2,11 +2,15 @@
 #define ENTITY_H
 
 #include <Arduino.h>
+#include <type_traits>
 
+// Plain data: no virtuals, no owned strings. The name is an interned ID
+// into NameTables, so copying an entity (or anything derived from it) is
+// a memcpy. Player and Enemy hide performAttack/performDefend with their
+// own versions; every caller holds the concrete type.
 class Entity {
 protected:
     // Core stats
-    String name;
     int maxHP;
     int currentHP;
     int attack;
@@ -14,16 +18,19 @@ protected:
     int speed;
     
     // Combat state
-    bool isDefending;
     int temporaryDefense;
+    bool isDefending;
+    
+    uint8_t nameID;  // NameTables::getEntityName key
     
 public:
     // Constructors
     Entity();
-    Entity(String entityName, int hp, int atk, int def, int spd);
+    Entity(uint8_t entityNameID, int hp, int atk, int def, int spd);
     
     // Basic getters
-    String getName() const;
+    const char* getName() const;  // From the name table (flash)
+    uint8_t getNameID() const;
     int getCurrentHP() const;
     int getMaxHP() const;
     int getAttack() const;
@@ -31,27 +38,28 @@ public:
     int getSpeed() const;
     
     // Basic setters
-    void setName(String newName);
+    void setNameID(uint8_t newNameID);
     void setStats(int hp, int atk, int def, int spd);
     
     // Health management
+    void setCurrentHP(int hp);
     void takeDamage(int damage);
     void heal(int amount);
     bool isAlive() const;
     
     // Combat actions
-    virtual int performAttack();
-    virtual int performDefend();
+    int performAttack();
+    int performDefend();
     void resetDefense();
     
     // Defense state
     void setDefending(bool defending);
     bool getIsDefending() const;
     void addTemporaryDefense(int defense);
+    int getTemporaryDefense() const;
     int getTotalDefense() const;
-    
-    // Virtual destructor for inheritance
-    virtual ~Entity();
 };
 
+static_assert(std::is_trivially_copyable<Entity>::value, "Entity must stay plain data");
+
 #endif
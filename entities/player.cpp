@@ -2,40 +2,27 @@
 #include "../utils/constants.h"
 
 // Default constructor - creates a basic adventurer
-Player::Player() : Entity("Adventurer", PLAYER_START_HP, PLAYER_START_ATK, PLAYER_START_DEF, PLAYER_START_SPD) {
-    baseHP = PLAYER_START_HP;
-    baseAttack = PLAYER_START_ATK;
-    baseDefense = PLAYER_START_DEF;
-    baseSpeed = PLAYER_START_SPD;
-    
-    equipmentHP = 0;
-    equipmentAttack = 0;
-    equipmentDefense = 0;
-    equipmentSpeed = 0;
-    
-    healthPotions = STARTING_POTIONS;
-    gold = STARTING_GOLD;
+Player::Player() : Entity(NAME_ID_ADVENTURER, PLAYER_START_HP, PLAYER_START_ATK, PLAYER_START_DEF, PLAYER_START_SPD) {
+    initStats(PLAYER_START_HP, PLAYER_START_ATK, PLAYER_START_DEF, PLAYER_START_SPD);
+    addHealthPotions(STARTING_POTIONS);
     gold = 50; // Start with some gold for first shop visit
 }
 
 // Constructor with name
-Player::Player(String playerName) : Entity(playerName, PLAYER_START_HP, PLAYER_START_ATK, PLAYER_START_DEF, PLAYER_START_SPD) {
-    baseHP = PLAYER_START_HP;
-    baseAttack = PLAYER_START_ATK;
-    baseDefense = PLAYER_START_DEF;
-    baseSpeed = PLAYER_START_SPD;
-    
-    equipmentHP = 0;
-    equipmentAttack = 0;
-    equipmentDefense = 0;
-    equipmentSpeed = 0;
-    
-    healthPotions = STARTING_POTIONS;
+Player::Player(uint8_t playerNameID) : Entity(playerNameID, PLAYER_START_HP, PLAYER_START_ATK, PLAYER_START_DEF, PLAYER_START_SPD) {
+    initStats(PLAYER_START_HP, PLAYER_START_ATK, PLAYER_START_DEF, PLAYER_START_SPD);
+    addHealthPotions(STARTING_POTIONS);
     gold = STARTING_GOLD;
 }
 
 // Constructor with custom stats
-Player::Player(String playerName, int hp, int atk, int def, int spd) : Entity(playerName, hp, atk, def, spd) {
+Player::Player(uint8_t playerNameID, int hp, int atk, int def, int spd) : Entity(playerNameID, hp, atk, def, spd) {
+    initStats(hp, atk, def, spd);
+    addHealthPotions(STARTING_POTIONS);
+    gold = 0;
+}
+
+void Player::initStats(int hp, int atk, int def, int spd) {
     baseHP = hp;
     baseAttack = atk;
     baseDefense = def;
@@ -45,56 +32,166 @@ Player::Player(String playerName, int hp, int atk, int def, int spd) : Entity(pl
     equipmentAttack = 0;
     equipmentDefense = 0;
     equipmentSpeed = 0;
+    activeSets = 0;
+    effectHP = 0;
+    effectAttack = 0;
+    effectDefense = 0;
+    effectSpeed = 0;
+    effectCount = 0;
+    statsDirty = false;
     
-    healthPotions = STARTING_POTIONS;
+    level = 1;
+    experience = 0;
+    nextLevelXP = PlayerLevels::getExperienceFor(2);
 }
 
-// Equipment system
-void Player::addEquipmentBonus(int hpBonus, int atkBonus, int defBonus, int spdBonus) {
-    equipmentHP += hpBonus;
-    equipmentAttack += atkBonus;
-    equipmentDefense += defBonus;
-    equipmentSpeed += spdBonus;
-    
-    updateStatsFromEquipment();
+// Derived stats
+void Player::markStatsDirty() {
+    statsDirty = true;
 }
 
-void Player::removeEquipmentBonus(int hpBonus, int atkBonus, int defBonus, int spdBonus) {
-    equipmentHP -= hpBonus;
-    equipmentAttack -= atkBonus;
-    equipmentDefense -= defBonus;
-    equipmentSpeed -= spdBonus;
+void Player::refreshStats() {
+    if (!statsDirty) return;
+    statsDirty = false;
     
-    // Don't let equipment bonuses go negative
-    if (equipmentHP < 0) equipmentHP = 0;
-    if (equipmentAttack < 0) equipmentAttack = 0;
-    if (equipmentDefense < 0) equipmentDefense = 0;
-    if (equipmentSpeed < 0) equipmentSpeed = 0;
+    // Equipped items and set bonuses: one lookup for the whole loadout
+    const LoadoutBonus& gear = ItemCatalog::getLoadoutBonus(inventory.getLoadout());
+    equipmentHP = gear.hp;
+    equipmentAttack = gear.attack;
+    equipmentDefense = gear.defense;
+    equipmentSpeed = gear.speed;
+    activeSets = gear.sets;
     
-    updateStatsFromEquipment();
-}
-
-void Player::updateStatsFromEquipment() {
-    // Calculate total stats
-    int totalHP = baseHP + equipmentHP;
-    int totalAttack = baseAttack + equipmentAttack;
-    int totalDefense = baseDefense + equipmentDefense;
-    int totalSpeed = baseSpeed + equipmentSpeed;
+    // Active effects
+    effectHP = 0;
+    effectAttack = 0;
+    effectDefense = 0;
+    effectSpeed = 0;
+    for (int i = 0; i < effectCount; i++) {
+        effectHP += effects[i].hp;
+        effectAttack += effects[i].attack;
+        effectDefense += effects[i].defense;
+        effectSpeed += effects[i].speed;
+    }
     
-    // Store current HP percentage to maintain it after stat change
-    float hpPercentage = (float)currentHP / (float)maxHP;
+    const LevelStats& growth = PlayerLevels::getStats(level);
+    int totalHP = baseHP + growth.hp + equipmentHP + effectHP;
+    int totalAttack = baseAttack + growth.attack + equipmentAttack + effectAttack;
+    int totalDefense = baseDefense + growth.defense + equipmentDefense + effectDefense;
+    int totalSpeed = baseSpeed + growth.speed + equipmentSpeed + effectSpeed;
+    if (totalHP < 1) totalHP = 1;
+    if (totalAttack < 0) totalAttack = 0;
+    if (totalDefense < 0) totalDefense = 0;
+    if (totalSpeed < 0) totalSpeed = 0;
+    
+    // Keep the same share of max HP (so player doesn't lose health when
+    // equipping items), in integer math: current * new / old
+    bool wasAlive = isAlive();
+    if (maxHP > 0 && totalHP != maxHP) {
+        currentHP = currentHP * totalHP / maxHP;
+    }
+    if (currentHP > totalHP) currentHP = totalHP;
+    if (currentHP < 1 && wasAlive) {
+        currentHP = 1;  // Don't accidentally kill player with equipment changes
+    }
     
-    // Update stats
     maxHP = totalHP;
     attack = totalAttack;
     defense = totalDefense;
     speed = totalSpeed;
+}
+
+// Active effects
+void Player::addEffect(int hpBonus, int atkBonus, int defBonus, int spdBonus, int rooms) {
+    if (rooms < 1) rooms = 1;
     
-    // Restore HP percentage (so player doesn't lose health when equipping items)
-    currentHP = (int)(maxHP * hpPercentage);
-    if (currentHP < 1 && isAlive()) {
-        currentHP = 1;  // Don't accidentally kill player with equipment changes
+    // When full, the effect closest to running out makes room
+    int index = effectCount;
+    if (effectCount == MAX_ACTIVE_EFFECTS) {
+        index = 0;
+        for (int i = 1; i < effectCount; i++) {
+            if (effects[i].roomsLeft < effects[index].roomsLeft) index = i;
+        }
+    } else {
+        effectCount++;
+    }
+    
+    effects[index].hp = (int8_t)hpBonus;
+    effects[index].attack = (int8_t)atkBonus;
+    effects[index].defense = (int8_t)defBonus;
+    effects[index].speed = (int8_t)spdBonus;
+    effects[index].roomsLeft = (uint8_t)rooms;
+    markStatsDirty();
+}
+
+void Player::tickEffects() {
+    int kept = 0;
+    for (int i = 0; i < effectCount; i++) {
+        effects[i].roomsLeft--;
+        if (effects[i].roomsLeft > 0) {
+            effects[kept++] = effects[i];
+        }
+    }
+    
+    if (kept != effectCount) {
+        Serial.println("A potion effect wore off.");
+        effectCount = kept;
+        markStatsDirty();
+        refreshStats();
+    }
+}
+
+int Player::cureEffects() {
+    int kept = 0;
+    for (int i = 0; i < effectCount; i++) {
+        const ActiveEffect& effect = effects[i];
+        bool harmful = effect.hp < 0 || effect.attack < 0 || effect.defense < 0 || effect.speed < 0;
+        if (!harmful) {
+            effects[kept++] = effect;
+        }
+    }
+    
+    int cured = effectCount - kept;
+    if (cured > 0) {
+        effectCount = kept;
+        markStatsDirty();
     }
+    return cured;
+}
+
+int Player::getActiveEffectCount() const {
+    return effectCount;
+}
+
+// Experience and levels
+int Player::addExperience(int amount) {
+    if (amount <= 0) return 0;
+    experience += amount;
+    if (experience < nextLevelXP) return 0;
+    
+    // Rare path: one or more thresholds crossed
+    int gained = 0;
+    while (experience >= nextLevelXP) {
+        level++;
+        gained++;
+        nextLevelXP = PlayerLevels::getExperienceFor(level + 1);
+    }
+    Serial.println("Level up! Now level " + String(level));
+    markStatsDirty();
+    refreshStats();
+    return gained;
+}
+
+int Player::getLevel() const {
+    return level;
+}
+
+uint32_t Player::getExperience() const {
+    return experience;
+}
+
+uint32_t Player::getNextLevelExperience() const {
+    return nextLevelXP;
 }
 
 // Get base stats
@@ -131,14 +228,58 @@ int Player::getEquipmentSpeed() const {
     return equipmentSpeed;
 }
 
-// Item management
+int Player::getActiveSets() const {
+    return activeSets;
+}
+
+// Inventory
+Inventory& Player::getInventory() {
+    return inventory;
+}
+
+const Inventory& Player::getInventory() const {
+    return inventory;
+}
+
+bool Player::giveItem(int itemID, int quantity) {
+    const CatalogEntry* item = ItemCatalog::find(itemID);
+    if (!item || quantity <= 0) return false;
+    
+    // Gear doesn't stack, so each piece takes its own slot
+    int copies = ItemCatalog::isStackable(*item) ? 1 : quantity;
+    int perCopy = ItemCatalog::isStackable(*item) ? quantity : 1;
+    
+    // All or nothing: every copy needs its own free slot
+    if (copies > 1 && inventory.getItemCount() + copies > inventory.getMaxSlots()) {
+        Serial.println("Inventory is full!");
+        return false;
+    }
+    for (int i = 0; i < copies; i++) {
+        if (!inventory.addItem(itemID, perCopy)) return false;
+        
+        // Wear new gear right away if nothing is in that slot
+        if (item->type == ITEM_EQUIPMENT && inventory.getEquippedID(item->slot) == ITEM_ID_NONE) {
+            inventory.equipOrUnequipItem(itemID, this);
+        }
+    }
+    return true;
+}
+
+bool Player::useItem(int inventoryIndex) {
+    bool used = inventory.useItem(inventoryIndex, this);
+    refreshStats();
+    return used;
+}
+
+// Health potions
 void Player::addHealthPotions(int amount) {
-    healthPotions += amount;
+    if (amount > 0) {
+        inventory.addItem(ITEM_ID_HEALTH_POTION, amount);
+    }
 }
 
 bool Player::useHealthPotion() {
-    if (healthPotions > 0) {
-        healthPotions--;
+    if (inventory.removeItem(ITEM_ID_HEALTH_POTION, 1)) {
         heal(POTION_HEAL_AMOUNT);  // Use constant instead of hardcoded 30
         return true;
     }
@@ -146,7 +287,17 @@ bool Player::useHealthPotion() {
 }
 
 int Player::getHealthPotions() const {
-    return healthPotions;
+    return inventory.getQuantity(ITEM_ID_HEALTH_POTION);
+}
+
+void Player::setHealthPotions(int amount) {
+    if (amount < 0) amount = 0;
+    int current = getHealthPotions();
+    if (amount > current) {
+        inventory.addItem(ITEM_ID_HEALTH_POTION, amount - current);
+    } else if (amount < current) {
+        inventory.removeItem(ITEM_ID_HEALTH_POTION, current - amount);
+    }
 }
 
 // Currency system implementation
@@ -194,16 +345,13 @@ PlayerAction Player::chooseAction() {
     return ACTION_ATTACK;
 }
 
-// Reset to base stats (useful for testing)
+// Reset to base stats, dropping all items and effects (new run)
 void Player::resetToBaseStats() {
-    equipmentHP = 0;
-    equipmentAttack = 0;
-    equipmentDefense = 0;
-    equipmentSpeed = 0;
-    updateStatsFromEquipment();
-}
-
-// Destructor
-Player::~Player() {
-    // Nothing special to clean up
+    inventory.clear();
+    effectCount = 0;
+    level = 1;
+    experience = 0;
+    nextLevelXP = PlayerLevels::getExperienceFor(2);
+    markStatsDirty();
+    refreshStats();
 }
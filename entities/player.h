@@ -1,63 +1,108 @@
-
 #ifndef PLAYER_H
 #define PLAYER_H
 
 #include "entity.h"
+#include "player_levels.h"
+#include "../utils/name_tables.h"
+#include "../combat/combat_types.h"
+#include "../item/inventory.h"
+#include "../utils/constants.h"
 #include <Arduino.h>
 
-enum PlayerAction {
-    ACTION_ATTACK = 0,
-    ACTION_DEFEND = 1,
-    ACTION_USE_ITEM = 2
+// Temporary stat boost from a consumable, counted down per room
+struct ActiveEffect {
+    int8_t hp;
+    int8_t attack;
+    int8_t defense;
+    int8_t speed;
+    uint8_t roomsLeft;
 };
 
 class Player : public Entity {
 private:
-    // Base stats (without equipment)
+    // Base stats (level 1, without equipment)
     int baseHP;
     int baseAttack;
     int baseDefense;
     int baseSpeed;
     
-    // Equipment bonuses
+    // Cached bonus totals (valid while statsDirty is false). Equipment
+    // totals include set bonuses.
     int equipmentHP;
     int equipmentAttack;
     int equipmentDefense;
     int equipmentSpeed;
+    uint8_t activeSets;  // Bit per ItemCatalog::getSet index
+    int effectHP;
+    int effectAttack;
+    int effectDefense;
+    int effectSpeed;
+    bool statsDirty;
+    
+    ActiveEffect effects[MAX_ACTIVE_EFFECTS];
+    int effectCount;
+    
+    // Progression. nextLevelXP caches the next threshold, so checking for
+    // a level-up is one compare.
+    int level;
+    uint32_t experience;
+    uint32_t nextLevelXP;
     
-    // Inventory (simple for now)
-    int healthPotions;
+    // Items (potions included) and equipped gear
+    Inventory inventory;
     
     // Currency system
     int gold;
     
+    void initStats(int hp, int atk, int def, int spd);
+    
 public:
     // Constructor
     Player();
-    Player(String playerName);
-    Player(String playerName, int hp, int atk, int def, int spd);
+    Player(uint8_t playerNameID);  // NAME_ID_* from NameTables
+    Player(uint8_t playerNameID, int hp, int atk, int def, int spd);
+    
+    // Derived stats = base + level growth + equipped items + active effects. Changes only
+    // mark the cache dirty; refreshStats() recalculates once per batch.
+    void markStatsDirty();
+    void refreshStats();
     
-    // Equipment system
-    void addEquipmentBonus(int hpBonus, int atkBonus, int defBonus, int spdBonus);
-    void removeEquipmentBonus(int hpBonus, int atkBonus, int defBonus, int spdBonus);
-    void updateStatsFromEquipment();
+    // Active effects
+    void addEffect(int hpBonus, int atkBonus, int defBonus, int spdBonus, int rooms);
+    void tickEffects();  // Call once per completed room
+    int cureEffects();   // Drops effects that lower a stat, returns how many
+    int getActiveEffectCount() const;
     
-    // Get base stats (without equipment)
+    // Experience and levels
+    int addExperience(int amount);  // Returns levels gained (stats already refreshed)
+    int getLevel() const;
+    uint32_t getExperience() const;
+    uint32_t getNextLevelExperience() const;  // 0xFFFFFFFF at the level cap
+    
+    // Get base stats (level 1, without equipment)
     int getBaseHP() const;
     int getBaseAttack() const;
     int getBaseDefense() const;
     int getBaseSpeed() const;
     
-    // Get equipment bonuses
+    // Get equipment bonuses (sets included)
     int getEquipmentHP() const;
     int getEquipmentAttack() const;
     int getEquipmentDefense() const;
     int getEquipmentSpeed() const;
+    int getActiveSets() const;
+    
+    // Inventory
+    Inventory& getInventory();
+    const Inventory& getInventory() const;
+    bool giveItem(int itemID, int quantity = 1);  // All or nothing; equips gear into an empty slot; call refreshStats() after
+    bool useItem(int inventoryIndex);
     
-    // Items
+    // Health potions (stored in the inventory)
     void addHealthPotions(int amount);
     bool useHealthPotion();
     int getHealthPotions() const;
+    void setHealthPotions(int amount);
     
     // Currency system
     int getGold() const;
@@ -66,17 +111,17 @@ public:
     bool hasEnoughGold(int amount) const;
     
     // Player-specific combat actions
-    int performAttack() override;
-    int performDefend() override;
+    int performAttack();
+    int performDefend();
     bool performUseItem();
     
     // Action selection (returns PlayerAction enum)
     PlayerAction chooseAction();  // Will be implemented later with input
     
-    // Reset to base stats (useful for testing/debugging)
+    // Reset to base stats and level 1, dropping all items and effects
     void resetToBaseStats();
-    
-    virtual ~Player();
 };
 
+static_assert(std::is_trivially_copyable<Player>::value, "Player must stay plain data (inventory and effects are inline)");
+
 #endif
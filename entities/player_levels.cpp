@@ -0,0 +1,64 @@
+#include "player_levels.h"
+
+// XP to reach level L: XP_PER_LEVEL * (L-1) + XP_CURVE * (L-1)^2, so each
+// level costs a bit more than the last (40 for level 2, 1080 for level 10)
+static const int XP_PER_LEVEL = 30;
+static const int XP_CURVE = 10;
+
+// Stat gain per level in tenths (HP +5, ATK +1.5, DEF +1, SPD +0.5)
+static const int HP_GAIN_TENTHS = 50;
+static const int ATTACK_GAIN_TENTHS = 15;
+static const int DEFENSE_GAIN_TENTHS = 10;
+static const int SPEED_GAIN_TENTHS = 5;
+
+static constexpr uint32_t experienceFor(int level) {
+    return (uint32_t)(XP_PER_LEVEL * (level - 1) + XP_CURVE * (level - 1) * (level - 1));
+}
+
+static constexpr int levelGain(int tenths, int level) {
+    return tenths * (level - 1) / 10;
+}
+
+static constexpr LevelStats makeLevel(int level) {
+    return LevelStats{
+        experienceFor(level),
+        (uint8_t)levelGain(HP_GAIN_TENTHS, level),
+        (uint8_t)levelGain(ATTACK_GAIN_TENTHS, level),
+        (uint8_t)levelGain(DEFENSE_GAIN_TENTHS, level),
+        (uint8_t)levelGain(SPEED_GAIN_TENTHS, level)
+    };
+}
+
+// [level - 1], built entirely at compile time
+static constexpr LevelStats LEVEL_TABLE[MAX_PLAYER_LEVEL] = {
+    makeLevel(1),  makeLevel(2),  makeLevel(3),  makeLevel(4),  makeLevel(5),
+    makeLevel(6),  makeLevel(7),  makeLevel(8),  makeLevel(9),  makeLevel(10),
+    makeLevel(11), makeLevel(12), makeLevel(13), makeLevel(14), makeLevel(15),
+    makeLevel(16), makeLevel(17), makeLevel(18), makeLevel(19), makeLevel(20)
+};
+
+static_assert(MAX_PLAYER_LEVEL == 20, "Add a makeLevel row for every level");
+static_assert(LEVEL_TABLE[0].experience == 0 && LEVEL_TABLE[0].hp == 0 && LEVEL_TABLE[0].attack == 0,
+              "Level 1 must be the starting stats");
+static_assert(levelGain(HP_GAIN_TENTHS, MAX_PLAYER_LEVEL) <= 255, "Level bonuses must fit a byte");
+
+// Each level must cost more XP than the one before
+static constexpr bool costsGrow(int level) {
+    return level >= MAX_PLAYER_LEVEL ||
+           (LEVEL_TABLE[level].experience - LEVEL_TABLE[level - 1].experience >
+            LEVEL_TABLE[level - 1].experience - (level > 1 ? LEVEL_TABLE[level - 2].experience : 0) &&
+            costsGrow(level + 1));
+}
+static_assert(costsGrow(1), "Level costs must grow");
+
+const LevelStats& PlayerLevels::getStats(int level) {
+    if (level < 1) level = 1;
+    if (level > MAX_PLAYER_LEVEL) level = MAX_PLAYER_LEVEL;
+    return LEVEL_TABLE[level - 1];
+}
+
+uint32_t PlayerLevels::getExperienceFor(int level) {
+    if (level < 1) return 0;
+    if (level > MAX_PLAYER_LEVEL) return 0xFFFFFFFF;  // Never
+    return LEVEL_TABLE[level - 1].experience;
+}
@@ -0,0 +1,27 @@
+#ifndef PLAYER_LEVELS_H
+#define PLAYER_LEVELS_H
+
+#include <stdint.h>
+
+// Highest level the hero can reach
+static const int MAX_PLAYER_LEVEL = 20;
+
+// One row of the level curve: total XP needed to reach the level, and the
+// stat bonus over level 1 while at it
+struct LevelStats {
+    uint32_t experience;
+    uint8_t hp;
+    uint8_t attack;
+    uint8_t defense;
+    uint8_t speed;
+};
+
+// XP and stat growth per level. The table is computed by the compiler from
+// the growth constants, so a level lookup is a single table load.
+class PlayerLevels {
+public:
+    static const LevelStats& getStats(int level);   // Clamped to 1..MAX_PLAYER_LEVEL
+    static uint32_t getExperienceFor(int level);    // Total XP to reach level (0xFFFFFFFF past the cap)
+};
+
+#endif
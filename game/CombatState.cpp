@@ -38,12 +38,12 @@ void CombatGameState::startNewCombat() {
     // Get enemy from current room
     Room* currentRoom = dungeonManager->getCurrentFloor()->getCurrentRoom();
     if (currentRoom) {
-        *currentEnemy = currentRoom->createEnemy();
-        Serial.println("Combat: Fighting " + currentEnemy->getName() + " in " + currentRoom->getRoomName());
+        currentRoom->spawnEnemy(*currentEnemy);
+        Serial.println(String("Combat: Fighting ") + currentEnemy->getName() + " in " + currentRoom->getRoomName());
     } else {
         // Fallback to random enemy
-        *currentEnemy = Enemy::createRandomEnemy();
-        Serial.println("Combat: Fighting random " + currentEnemy->getName());
+        currentEnemy->spawnRandom();
+        Serial.println(String("Combat: Fighting random ") + currentEnemy->getName());
     }
     
     // Start combat
@@ -67,7 +67,8 @@ void CombatGameState::handleCombatInput() {
     if (result == MenuResult::SELECTED) {
         // Convert menu selection to PlayerAction
         CombatAction menuAction = combatMenu->getSelectedAction();
-        PlayerAction playerAction;
+        PlayerAction playerAction = ACTION_ATTACK;
+        bool autoResolve = false;
         
         switch (menuAction) {
             case CombatAction::ATTACK:
@@ -79,10 +80,19 @@ void CombatGameState::handleCombatInput() {
             case CombatAction::ITEM:
                 playerAction = ACTION_USE_ITEM;
                 break;
+            case CombatAction::AUTO:
+                autoResolve = true;
+                break;
         }
         
-        // Process the combat turn
-        CombatResult combatResult = combatManager->processTurn(playerAction);
+        // Process the combat turn (or the whole fight)
+        CombatResult combatResult;
+        if (autoResolve) {
+            AutoResolveSummary summary;
+            combatResult = combatManager->autoResolve(summary);
+        } else {
+            combatResult = combatManager->processTurn(playerAction);
+        }
         
         // Update display
         combatHUD->updateCombatStats(player, currentEnemy, combatManager->getTurnCounter());
@@ -90,7 +100,8 @@ void CombatGameState::handleCombatInput() {
         // Check if combat is over
         if (combatResult == RESULT_VICTORY || combatResult == RESULT_DEFEAT) {
             if (combatResult == RESULT_VICTORY) {
-                combatHUD->drawVictoryScreen();
+                LootDrop noLoot = {ITEM_ID_NONE, 0};  // Drops are rolled by CombatRoomState
+                combatHUD->drawVictoryScreen(noLoot, 0);
                 
                 // Mark room as completed and advance dungeon
                 dungeonManager->markRoomCompleted();
@@ -1,7 +1,16 @@
 #include "DoorChoiceState.h"
+#include "../utils/name_tables.h"
+#include <stdio.h>
+#include <string.h>
 
 DoorChoiceState::DoorChoiceState(Display* disp, Input* inp, DungeonManager* dm) : GameState(disp, inp) {
     dungeonManager = dm;
+    availableChoices = nullptr;
+    choiceCount = 0;
+    leftDoorIcon = rightDoorIcon = "";
+    leftDoorDesc = rightDoorDesc = "";
+    leftDoorHint[0] = '\0';
+    rightDoorHint[0] = '\0';
     selectedOption = 0;
     maxOptions = 3;  // Left door, right door, campfire
     screenDrawn = false;
@@ -32,20 +41,24 @@ void DoorChoiceState::exit() {
 }
 
 void DoorChoiceState::generateDoorChoices() {
-    availableChoices = dungeonManager->getAvailableRooms();
+    availableChoices = dungeonManager->getAvailableRooms(choiceCount);
     
-    if (availableChoices.size() >= 2) {
+    if (choiceCount >= 2) {
         // Two doors available
         leftDoorIcon = getDoorIconText(availableChoices[0].icon);
         leftDoorDesc = availableChoices[0].description;
+        formatRouteHint(availableChoices[0], leftDoorHint, HINT_BUFFER_SIZE);
         rightDoorIcon = getDoorIconText(availableChoices[1].icon);
         rightDoorDesc = availableChoices[1].description;
-    } else if (availableChoices.size() == 1) {
+        formatRouteHint(availableChoices[1], rightDoorHint, HINT_BUFFER_SIZE);
+    } else if (choiceCount == 1) {
         // Only boss room (floor complete)
         leftDoorIcon = getDoorIconText(availableChoices[0].icon);
         leftDoorDesc = availableChoices[0].description;
+        formatRouteHint(availableChoices[0], leftDoorHint, HINT_BUFFER_SIZE);
         rightDoorIcon = "[X]";
         rightDoorDesc = "No door here";
+        rightDoorHint[0] = '\0';
     }
 }
 
@@ -82,7 +95,10 @@ void DoorChoiceState::drawScreen() {
     // Controls (updated for navigation)
     int controlY = campfireY + campfireHeight + 15;
     display->drawText("UP/DOWN: Navigate", 10, controlY, TFT_WHITE);
-    display->drawText("A: Select", 10, controlY + 15, TFT_WHITE);
+    display->drawText("A:Select T/F:loot/fights", 10, controlY + 15, TFT_WHITE);
+    
+    // Floor map below the controls
+    drawFloorMap(5, controlY + 30, 160, Display::HEIGHT - (controlY + 30) - 5);
     
     screenDrawn = true;
     lastSelectedOption = selectedOption;
@@ -91,9 +107,10 @@ void DoorChoiceState::drawScreen() {
 void DoorChoiceState::drawFloorProgress() {
     Floor* currentFloor = dungeonManager->getCurrentFloor();
     if (currentFloor) {
-        String progress = "Floor " + String(dungeonManager->getCurrentFloorNumber()) + 
-                         " - Room " + String(currentFloor->getRoomsCompleted() + 1) + "/10";
-        display->drawText(progress.c_str(), 10, 35, TFT_WHITE);
+        char progress[32];
+        snprintf(progress, sizeof(progress), "Floor %d - Room %d/10",
+                 dungeonManager->getCurrentFloorNumber(), currentFloor->getRoomsCompleted() + 1);
+        display->drawText(progress, 10, 35, TFT_WHITE);
     }
 }
 
@@ -107,36 +124,39 @@ void DoorChoiceState::drawDoor(int doorIndex, int x, int y, int width, int heigh
     display->fillRect(x+1, y+1, width-2, height-2, bgColor);
     
     // Door label
-    String doorLabel = (doorIndex == 0) ? "LEFT" : "RIGHT";
-    display->drawText(doorLabel.c_str(), x + 10, y + 8, TFT_WHITE);
+    const char* doorLabel = (doorIndex == 0) ? "LEFT" : "RIGHT";
+    display->drawText(doorLabel, x + 10, y + 8, TFT_WHITE);
     
     // Icon
-    String icon = (doorIndex == 0) ? leftDoorIcon : rightDoorIcon;
-    display->drawText(icon.c_str(), x + 20, y + 25, TFT_CYAN, 2);
+    const char* icon = (doorIndex == 0) ? leftDoorIcon : rightDoorIcon;
+    display->drawText(icon, x + 20, y + 25, TFT_CYAN, 2);
     
     // Description (simplified for narrow doors)
-    String desc = (doorIndex == 0) ? leftDoorDesc : rightDoorDesc;
+    const char* desc = (doorIndex == 0) ? leftDoorDesc : rightDoorDesc;
     
     // Break into multiple lines
     int startY = y + 50;
     int lineHeight = 12;
-    int maxChars = 8; // Max chars per line for narrow door
+    const int maxChars = 8; // Max chars per line for narrow door
     
-    String currentLine = "";
+    char currentLine[maxChars + 1];
     int currentY = startY;
+    int length = strlen(desc);
     
-    for (int i = 0; i < desc.length(); i++) {
-        currentLine += desc.charAt(i);
+    for (int i = 0; i < length; i += maxChars) {
+        int count = (length - i < maxChars) ? length - i : maxChars;
+        memcpy(currentLine, desc + i, count);
+        currentLine[count] = '\0';
+        display->drawText(currentLine, x + 2, currentY, TFT_WHITE, 1);
+        currentY += lineHeight;
         
-        if (currentLine.length() >= maxChars || i == desc.length() - 1) {
-            display->drawText(currentLine.c_str(), x + 2, currentY, TFT_WHITE, 1);
-            currentY += lineHeight;
-            currentLine = "";
-            
-            if (currentY > y + height - 15) break; // Don't overflow door
-        }
+        if (currentY > y + height - 15) break; // Don't overflow door
     }
     
+    // Route hint along the bottom of the door
+    const char* hint = (doorIndex == 0) ? leftDoorHint : rightDoorHint;
+    display->drawText(hint, x + 2, y + height - 9, TFT_GREEN, 1);
+    
     // Selection indicator
     if (selected) {
         display->drawText(">", x - 8, y + height/2, TFT_YELLOW);
@@ -144,6 +164,71 @@ void DoorChoiceState::drawDoor(int doorIndex, int x, int y, int width, int heigh
     }
 }
 
+// Columns: entrance, one per layer, boss. Rooms are spread down their column.
+void DoorChoiceState::getMapNodePosition(const FloorGraph& graph, int node, int x, int y, int width, int height,
+                                         int& outX, int& outY) {
+    int columns = FLOOR_GRAPH_LAYERS + 2;
+    int columnWidth = width / columns;
+    
+    if (node == FLOOR_NODE_NONE) {
+        outX = x + columnWidth / 2;
+        outY = y + height / 2;
+        return;
+    }
+    
+    uint32_t packed = graph.nodes[node];
+    int layer = FloorGraphGen::getLayer(packed);
+    int rows = (node == FLOOR_BOSS_NODE) ? 1 : graph.layerWidth[layer];
+    int row = (node == FLOOR_BOSS_NODE) ? 0 : FloorGraphGen::getSlot(packed);
+    
+    outX = x + (layer + 1) * columnWidth + columnWidth / 2;
+    outY = y + (row * 2 + 1) * height / (rows * 2);
+}
+
+void DoorChoiceState::drawFloorMap(int x, int y, int width, int height) {
+    Floor* floor = dungeonManager->getCurrentFloor();
+    if (!floor) return;
+    
+    const FloorGraph& graph = floor->getGraph();
+    int current = floor->getCurrentNode();
+    int px, py, qx, qy;
+    
+    // Edges (entrance doors first, then the CSR adjacency)
+    getMapNodePosition(graph, FLOOR_NODE_NONE, x, y, width, height, px, py);
+    for (int i = 0; i < graph.entryCount; i++) {
+        getMapNodePosition(graph, graph.entry[i], x, y, width, height, qx, qy);
+        display->drawLine(px, py, qx, qy, TFT_WHITE);
+    }
+    for (int node = 0; node < graph.nodeCount; node++) {
+        getMapNodePosition(graph, node, x, y, width, height, px, py);
+        for (int e = 0; e < FloorGraphGen::getOutDegree(graph, node); e++) {
+            getMapNodePosition(graph, FloorGraphGen::getSuccessor(graph, node, e), x, y, width, height, qx, qy);
+            display->drawLine(px, py, qx, qy, TFT_WHITE);
+        }
+    }
+    
+    // Rooms, colored by type; doors on offer are outlined
+    for (int node = 0; node < graph.nodeCount; node++) {
+        uint16_t color;
+        switch (FloorGraphGen::getType(graph.nodes[node])) {
+            case NODE_ENEMY:    color = TFT_RED; break;
+            case NODE_TREASURE: color = TFT_YELLOW; break;
+            case NODE_SHOP:     color = TFT_GREEN; break;
+            default:            color = TFT_MAGENTA; break;
+        }
+        
+        getMapNodePosition(graph, node, x, y, width, height, px, py);
+        display->fillRect(px - 3, py - 3, 7, 7, color);
+        if (floor->isChoiceNode(node)) {
+            display->drawRect(px - 5, py - 5, 11, 11, TFT_CYAN);
+        }
+    }
+    
+    // Where we are
+    getMapNodePosition(graph, current, x, y, width, height, px, py);
+    display->drawRect(px - 5, py - 5, 11, 11, TFT_WHITE);
+}
+
 void DoorChoiceState::handleInput() {
     // Navigation with UP/DOWN
     if (input->wasPressed(Button::UP)) {
@@ -166,32 +251,44 @@ void DoorChoiceState::handleInput() {
             // Left door
             Room* selectedRoom = dungeonManager->selectRoom(0);
             if (selectedRoom) {
-                Serial.println("Selected LEFT door - " + selectedRoom->getRoomName());
+                Serial.print("Selected LEFT door - ");
+                Serial.println(selectedRoom->getRoomName());
                 
                 switch (selectedRoom->getType()) {
                     case ROOM_ENEMY:
                     case ROOM_BOSS:
                         requestStateChange(StateTransition::COMBAT);
                         break;
+                    case ROOM_TREASURE:
+                        requestStateChange(StateTransition::TREASURE);
+                        break;
+                    case ROOM_SHOP:
+                        requestStateChange(StateTransition::SHOP);
+                        break;
                     default:
-                        // For now, other rooms go back to main menu
                         requestStateChange(StateTransition::MAIN_MENU);
                         break;
                 }
             }
-        } else if (selectedOption == 1 && availableChoices.size() > 1) {
+        } else if (selectedOption == 1 && choiceCount > 1) {
             // Right door (only if available)
             Room* selectedRoom = dungeonManager->selectRoom(1);
             if (selectedRoom) {
-                Serial.println("Selected RIGHT door - " + selectedRoom->getRoomName());
+                Serial.print("Selected RIGHT door - ");
+                Serial.println(selectedRoom->getRoomName());
                 
                 switch (selectedRoom->getType()) {
                     case ROOM_ENEMY:
                     case ROOM_BOSS:
                         requestStateChange(StateTransition::COMBAT);
                         break;
+                    case ROOM_TREASURE:
+                        requestStateChange(StateTransition::TREASURE);
+                        break;
+                    case ROOM_SHOP:
+                        requestStateChange(StateTransition::SHOP);
+                        break;
                     default:
-                        // For now, other rooms go back to main menu
                         requestStateChange(StateTransition::MAIN_MENU);
                         break;
                 }
@@ -234,11 +331,14 @@ void DoorChoiceState::drawCampfire(int x, int y, int width, int height, bool sel
     }
 }
 
-String DoorChoiceState::getDoorIconText(DoorIcon icon) {
-    switch(icon) {
-        case ICON_SWORD: return "[!]";
-        case ICON_QUESTION: return "[?]";
-        case ICON_SKULL: return "[X]";
-        default: return "[*]";
+void DoorChoiceState::formatRouteHint(const DoorChoice& choice, char* out, int size) {
+    if (choice.room && choice.room->getType() == ROOM_BOSS) {
+        snprintf(out, size, "BOSS");
+    } else {
+        snprintf(out, size, "T%d F%d", choice.maxTreasure, choice.minFights);
     }
 }
+
+const char* DoorChoiceState::getDoorIconText(DoorIcon icon) {
+    return NameTables::getDoorIconText(icon);
+}
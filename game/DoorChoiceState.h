@@ -9,22 +9,32 @@ private:
     DungeonManager* dungeonManager;
     
     // Door choice data
-    std::vector<DoorChoice> availableChoices;
+    const DoorChoice* availableChoices;  // Owned by the current Floor
+    int choiceCount;
     int selectedOption;  // 0=left door, 1=right door, 2=campfire
     int maxOptions;      // Will be 3 (left, right, campfire)
     bool screenDrawn;
     int lastSelectedOption;
     
-    // Door content
-    String leftDoorIcon, rightDoorIcon;
-    String leftDoorDesc, rightDoorDesc;
+    // Door content (text points into the name tables; hints are formatted once)
+    static const int HINT_BUFFER_SIZE = 12;
+    const char* leftDoorIcon;
+    const char* rightDoorIcon;
+    const char* leftDoorDesc;
+    const char* rightDoorDesc;
+    char leftDoorHint[HINT_BUFFER_SIZE];   // Route hints: T = treasure, F = fights
+    char rightDoorHint[HINT_BUFFER_SIZE];
     
     // Helper methods
     void generateDoorChoices();
     void drawDoor(int doorIndex, int x, int y, int width, int height, bool selected);
     void drawCampfire(int x, int y, int width, int height, bool selected);
-    String getDoorIconText(DoorIcon icon);
+    const char* getDoorIconText(DoorIcon icon);
+    void formatRouteHint(const DoorChoice& choice, char* out, int size);
     void drawFloorProgress();
+    void drawFloorMap(int x, int y, int width, int height);
+    void getMapNodePosition(const FloorGraph& graph, int node, int x, int y, int width, int height,
+                            int& outX, int& outY);
     
 public:
     DoorChoiceState(Display* disp, Input* inp, DungeonManager* dm);
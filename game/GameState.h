@@ -10,6 +10,8 @@ enum class StateTransition {
     DOOR_CHOICE,
     COMBAT,
     CAMPFIRE,
+    TREASURE,
+    SHOP,
     GAME_OVER,
     SETTINGS,
     CREDITS,
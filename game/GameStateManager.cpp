@@ -1,11 +1,12 @@
 #include "GameStateManager.h"
+#include "../utils/rng.h"
 
 GameStateManager::GameStateManager(Display* disp, Input* inp) {
     display = disp;
     input = inp;
     
     // Initialize shared entities
-    player = new Player("Hero");
+    player = new Player(NAME_ID_HERO);
     currentEnemy = new Enemy();
     dungeonManager = new DungeonManager(player);
     
@@ -14,6 +15,8 @@ GameStateManager::GameStateManager(Display* disp, Input* inp) {
     doorChoiceState = new DoorChoiceState(display, input, dungeonManager);
     combatRoomState = new CombatRoomState(display, input, player, currentEnemy, dungeonManager);
     campfireRoomState = new CampfireRoomState(display, input, player, currentEnemy, dungeonManager);
+    treasureRoomState = new TreasureRoomState(display, input, player, currentEnemy, dungeonManager);
+    shopRoomState = new ShopRoomState(display, input, player, currentEnemy, dungeonManager);
     
     // Start with main menu
     currentState = mainMenuState;
@@ -27,12 +30,17 @@ GameStateManager::~GameStateManager() {
     delete doorChoiceState;
     delete combatRoomState;
     delete campfireRoomState;
+    delete treasureRoomState;
+    delete shopRoomState;
 }
 
 void GameStateManager::initialize() {
     Serial.println("=== ESP32 Dungeon Crawler ===");
     Serial.println("Game State Manager Initialized");
     
+    // Pick a fresh run seed (hardware RNG) for all random streams
+    startNewRun(esp_random());
+    
     // Enter initial state
     currentState->enter();
 }
@@ -41,6 +49,9 @@ void GameStateManager::update() {
     // Update current state
     currentState->update();
     
+    // Background work (next floor generation) in the rest of the frame
+    dungeonManager->update();
+    
     // Check for state transitions
     StateTransition nextState = currentState->getNextState();
     if (nextState != StateTransition::NONE) {
@@ -71,6 +82,14 @@ void GameStateManager::changeState(StateTransition newState) {
             currentState = campfireRoomState;
             break;
             
+        case StateTransition::TREASURE:
+            currentState = treasureRoomState;
+            break;
+            
+        case StateTransition::SHOP:
+            currentState = shopRoomState;
+            break;
+            
         case StateTransition::GAME_OVER:
             handlePlaceholderState(newState);
             return; // Don't change state, just show screen
@@ -152,12 +171,20 @@ void GameStateManager::resetDungeonProgress() {
     Serial.println("Dungeon progress reset - starting from Floor 1");
 }
 
+void GameStateManager::startNewRun(uint32_t seed) {
+    RngService::seedRun(seed);
+    Serial.println("Run seed: " + String(seed));
+}
+
 void GameStateManager::fullGameReset() {
     // Reset player to base stats (lose all equipment/progress)
     player->resetToBaseStats();
     player->heal(player->getMaxHP());
     player->addHealthPotions(3);
     
+    // New run gets a new seed
+    startNewRun(esp_random());
+    
     // Reset dungeon progress
     resetDungeonProgress();
     
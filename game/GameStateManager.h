@@ -8,6 +8,8 @@
 #include "DoorChoiceState.h"
 #include "../rooms/CombatRoomState.h"
 #include "../rooms/CampfireRoomState.h"
+#include "../rooms/TreasureRoomState.h"
+#include "../rooms/ShopRoomState.h"
 #include "../entities/player.h"
 #include "../entities/enemy.h"
 #include "../dungeon/DungeonManager.h"
@@ -29,6 +31,8 @@ private:
     DoorChoiceState* doorChoiceState;
     CombatRoomState* combatRoomState;
     CampfireRoomState* campfireRoomState;
+    TreasureRoomState* treasureRoomState;
+    ShopRoomState* shopRoomState;
     
     // State transition
     void changeState(StateTransition newState);
@@ -46,6 +50,7 @@ public:
     void resetPlayer();
     void resetDungeonProgress();
     void fullGameReset();  // Reset everything for new game
+    void startNewRun(uint32_t seed);  // Reseed all random streams (same seed = same run)
     
     // Dungeon access (for states that need it)
     DungeonManager* getDungeonManager() const { return dungeonManager; }
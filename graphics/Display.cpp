@@ -36,12 +36,20 @@ void Display::fillRect(int x, int y, int w, int h, uint16_t color) {
     tft.fillRect(x, y, w, h, color);
 }
 
+void Display::drawLine(int x0, int y0, int x1, int y1, uint16_t color) {
+    tft.drawLine(x0, y0, x1, y1, color);
+}
+
 void Display::drawText(const char* text, int x, int y, uint16_t color) {
     drawText(text, x, y, color, 1);
 }
 
 void Display::drawText(const char* text, int x, int y, uint16_t color, uint8_t size) {
-    tft.setTextColor(color, TFT_BLACK);
+    drawText(text, x, y, color, TFT_BLACK, size);
+}
+
+void Display::drawText(const char* text, int x, int y, uint16_t color, uint16_t bgColor, uint8_t size) {
+    tft.setTextColor(color, bgColor);
     tft.setTextSize(size);
     tft.setCursor(x, y);
     tft.print(text);
@@ -22,10 +22,12 @@ public:
     void drawPixel(int x, int y, uint16_t color);
     void drawRect(int x, int y, int w, int h, uint16_t color);
     void fillRect(int x, int y, int w, int h, uint16_t color);
+    void drawLine(int x0, int y0, int x1, int y1, uint16_t color);
     
     // Text functions
     void drawText(const char* text, int x, int y, uint16_t color);
     void drawText(const char* text, int x, int y, uint16_t color, uint8_t size);
+    void drawText(const char* text, int x, int y, uint16_t color, uint16_t bgColor, uint8_t size);
     
     // Sprite functions (for future use)
     void drawSprite(const uint8_t* spriteData, int x, int y, int w, int h);
@@ -2,39 +2,47 @@
 #include "item_types/consumable.h"
 #include "item_types/equipment.h"
 #include "../entities/player.h"
+#include <stdio.h>
 
 // Constructor
 Inventory::Inventory(int slots) {
+    if (slots < 0) slots = 0;
+    if (slots > MAX_INVENTORY_SLOTS) slots = MAX_INVENTORY_SLOTS;
     maxSlots = slots;
-    equippedWeapon = nullptr;
-    equippedArmor = nullptr;
-    equippedAccessory = nullptr;
-    items.clear();
+    slotCount = 0;
+    for (int i = 0; i < EQUIPMENT_SLOT_COUNT; i++) {
+        equipped[i] = ITEM_ID_NONE;
+    }
+    rebuildIndex();
 }
 
 // Add item to inventory
-bool Inventory::addItem(Item* item, int quantity) {
-    if (!item || quantity <= 0) return false;
+bool Inventory::addItem(int itemID, int quantity) {
+    const CatalogEntry* entry = ItemCatalog::find(itemID);
+    if (!entry || quantity <= 0) return false;
     
     // Check if we have space
-    if (!hasSpace(item, quantity)) {
+    if (!hasSpace(itemID, quantity)) {
         Serial.println("Inventory is full!");
         return false;
     }
     
     // If item is stackable, try to add to existing stack
-    if (item->isStackable()) {
-        int existingIndex = findItemIndex(item->getID());
+    if (ItemCatalog::isStackable(*entry)) {
+        int existingIndex = findItemIndex(itemID);
         if (existingIndex != -1) {
-            items[existingIndex].quantity += quantity;
-            Serial.println("Added " + String(quantity) + "x " + item->getName() + " to inventory.");
+            slots[existingIndex].quantity += quantity;
+            Serial.println("Added " + String(quantity) + "x " + entry->name + " to inventory.");
             return true;
         }
     }
     
-    // Add as new slot
-    items.push_back(InventorySlot(item, quantity));
-    Serial.println("Added " + String(quantity) + "x " + item->getName() + " to inventory.");
+    // Add as new slot (the index keeps the first slot for repeated gear)
+    slots[slotCount] = InventorySlot(itemID, quantity);
+    int row = ItemCatalog::indexOf(itemID);
+    if (slotByItem[row] < 0) slotByItem[row] = slotCount;
+    slotCount++;
+    Serial.println("Added " + String(quantity) + "x " + entry->name + " to inventory.");
     return true;
 }
 
@@ -43,14 +51,16 @@ bool Inventory::removeItem(int itemID, int quantity) {
     int index = findItemIndex(itemID);
     if (index == -1) return false;
     
-    if (items[index].quantity >= quantity) {
-        items[index].quantity -= quantity;
+    if (slots[index].quantity >= quantity) {
+        slots[index].quantity -= quantity;
         
-        // Remove slot if quantity reaches 0
-        if (items[index].quantity == 0) {
-            // Don't delete the item here - it might be referenced elsewhere (like equipped items)
-            // Just remove from inventory
-            items.erase(items.begin() + index);
+        // Remove slot if quantity reaches 0 (shift down to keep the order)
+        if (slots[index].quantity == 0) {
+            for (int i = index; i < slotCount - 1; i++) {
+                slots[i] = slots[i + 1];
+            }
+            slotCount--;
+            rebuildIndex();
         }
         return true;
     }
@@ -58,43 +68,41 @@ bool Inventory::removeItem(int itemID, int quantity) {
     return false; // Not enough quantity
 }
 
+void Inventory::clear() {
+    slotCount = 0;
+    for (int i = 0; i < EQUIPMENT_SLOT_COUNT; i++) {
+        equipped[i] = ITEM_ID_NONE;
+    }
+    rebuildIndex();
+}
+
 // Check if inventory has item
 bool Inventory::hasItem(int itemID, int quantity) const {
     int index = findItemIndex(itemID);
     if (index == -1) return false;
     
-    return items[index].quantity >= quantity;
-}
-
-// Get item by ID
-Item* Inventory::getItemByID(int itemID) const {
-    int index = findItemIndex(itemID);
-    if (index != -1) {
-        return items[index].item;
-    }
-    return nullptr;
+    return slots[index].quantity >= quantity;
 }
 
 // Use item from inventory
 bool Inventory::useItem(int inventoryIndex, Player* player) {
-    if (inventoryIndex < 0 || inventoryIndex >= items.size()) {
+    if (inventoryIndex < 0 || inventoryIndex >= slotCount) {
         Serial.println("Invalid item selection!");
         return false;
     }
     
-    Item* item = items[inventoryIndex].item;
-    if (!item) return false;
+    Item item(slots[inventoryIndex].itemID);
+    if (!item.isValid()) return false;
     
     // Special handling for equipment
-    if (item->getType() == ITEM_EQUIPMENT) {
-        Equipment* equipment = static_cast<Equipment*>(item);
-        return equipOrUnequipItem(equipment, player);
+    if (item.getType() == ITEM_EQUIPMENT) {
+        return equipOrUnequipItem(item.getID(), player);
     }
     
     // Handle consumables normally
-    if (item->use(player)) {
+    if (item.use(player)) {
         // Successfully used, remove one from inventory
-        removeItem(item->getID(), 1);
+        removeItem(item.getID(), 1);
         return true;
     }
     
@@ -112,24 +120,27 @@ bool Inventory::useItemByID(int itemID, Player* player) {
     return false;
 }
 
-// Helper method to find item index
+// Helper method to find item index (O(1) through the catalog row)
 int Inventory::findItemIndex(int itemID) const {
-    for (int i = 0; i < items.size(); i++) {
-        if (items[i].item && items[i].item->getID() == itemID) {
-            return i;
-        }
-    }
-    return -1; // Not found
+    int row = ItemCatalog::indexOf(itemID);
+    if (row < 0) return -1;
+    return slotByItem[row];
 }
 
-// Find empty slot
-int Inventory::findEmptySlot() const {
-    return items.size(); // Next available index
+// Recompute the item -> slot index after slots move
+void Inventory::rebuildIndex() {
+    for (int i = 0; i < ITEM_CATALOG_SIZE; i++) {
+        slotByItem[i] = -1;
+    }
+    for (int i = 0; i < slotCount; i++) {
+        int row = ItemCatalog::indexOf(slots[i].itemID);
+        if (row >= 0 && slotByItem[row] < 0) slotByItem[row] = i;
+    }
 }
 
 // Information methods
 int Inventory::getItemCount() const {
-    return items.size();
+    return slotCount;
 }
 
 int Inventory::getMaxSlots() const {
@@ -143,175 +154,186 @@ bool Inventory::isFull() const {
 int Inventory::getQuantity(int itemID) const {
     int index = findItemIndex(itemID);
     if (index != -1) {
-        return items[index].quantity;
+        return slots[index].quantity;
     }
     return 0;
 }
 
 // Equipment slot management
-bool Inventory::equipOrUnequipItem(Equipment* equipment, Player* player) {
-    if (!equipment || !player) return false;
+bool Inventory::equipOrUnequipItem(int itemID, Player* player) {
+    const CatalogEntry* entry = ItemCatalog::find(itemID);
+    if (!entry || !player || entry->type != ITEM_EQUIPMENT) return false;
+    if (entry->slot >= EQUIPMENT_SLOT_COUNT) return false;
     
-    EquipmentSlot slot = equipment->getSlot();
-    Equipment** currentSlot = nullptr;
-    
-    // Get the appropriate equipment slot
-    switch(slot) {
-        case SLOT_WEAPON:
-            currentSlot = &equippedWeapon;
-            break;
-        case SLOT_ARMOR:
-            currentSlot = &equippedArmor;
-            break;
-        case SLOT_ACCESSORY:
-            currentSlot = &equippedAccessory;
-            break;
-        default:
-            return false;
-    }
+    uint16_t& currentSlot = equipped[entry->slot];
     
     // If this item is already equipped, unequip it
-    if (equipment->getIsEquipped()) {
-        equipment->unequip(player);
-        *currentSlot = nullptr;
+    if (currentSlot == itemID) {
+        Equipment::unequip(*entry, player);
+        currentSlot = ITEM_ID_NONE;
         return true;
     }
     
     // If there's already something equipped in this slot, unequip it first
-    if (*currentSlot != nullptr) {
-        (*currentSlot)->unequip(player);
-        Serial.println("Unequipped " + (*currentSlot)->getName() + " to make room.");
-        *currentSlot = nullptr; // Clear the slot
+    if (currentSlot != ITEM_ID_NONE) {
+        const CatalogEntry* current = ItemCatalog::find(currentSlot);
+        if (current) {
+            Equipment::unequip(*current, player);
+            Serial.println(String("Unequipped ") + current->name + " to make room.");
+        }
+        currentSlot = ITEM_ID_NONE; // Clear the slot
     }
     
     // Equip the new item
-    if (equipment->equip(player)) {
-        *currentSlot = equipment;
+    if (Equipment::equip(*entry, player)) {
+        currentSlot = itemID;
         return true;
     }
     
     return false;
 }
 
+bool Inventory::isEquipped(int itemID) const {
+    if (itemID == ITEM_ID_NONE) return false;
+    for (int i = 0; i < EQUIPMENT_SLOT_COUNT; i++) {
+        if (equipped[i] == itemID) return true;
+    }
+    return false;
+}
+
 // Access methods
-std::vector<InventorySlot> Inventory::getItems() const {
-    return items;
+InventoryView Inventory::getItems() const {
+    InventoryView view = {slots, slotCount};
+    return view;
 }
 
-Item* Inventory::getItem(int index) const {
-    if (index >= 0 && index < items.size()) {
-        return items[index].item;
+Item Inventory::getItem(int index) const {
+    if (index >= 0 && index < slotCount) {
+        return Item(slots[index].itemID);
     }
-    return nullptr;
+    return Item();
 }
 
 int Inventory::getSlotQuantity(int index) const {
-    if (index >= 0 && index < items.size()) {
-        return items[index].quantity;
+    if (index >= 0 && index < slotCount) {
+        return slots[index].quantity;
     }
     return 0;
 }
 
 // Equipment getters
-Equipment* Inventory::getEquippedWeapon() const {
-    return equippedWeapon;
+int Inventory::getEquippedID(int slot) const {
+    if (slot < 0 || slot >= EQUIPMENT_SLOT_COUNT) return ITEM_ID_NONE;
+    return equipped[slot];
+}
+
+int Inventory::getEquippedWeapon() const {
+    return equipped[SLOT_WEAPON];
+}
+
+int Inventory::getEquippedArmor() const {
+    return equipped[SLOT_ARMOR];
+}
+
+int Inventory::getEquippedAccessory() const {
+    return equipped[SLOT_ACCESSORY];
 }
 
-Equipment* Inventory::getEquippedArmor() const {
-    return equippedArmor;
+int Inventory::getLoadout() const {
+    return ItemCatalog::getLoadout(equipped[SLOT_WEAPON], equipped[SLOT_ARMOR], equipped[SLOT_ACCESSORY]);
 }
 
-Equipment* Inventory::getEquippedAccessory() const {
-    return equippedAccessory;
+// One Serial listing entry (number, name, quantity, use text)
+void Inventory::printItem(int index, bool showRarity) const {
+    char line[80];
+    char use[64];
+    Item item(slots[index].itemID);
+    int qty = slots[index].quantity;
+    
+    int len;
+    if (showRarity) {
+        len = snprintf(line, sizeof(line), "%d. [%s] %s", index + 1, item.getRarityName(), item.getName());
+    } else {
+        len = snprintf(line, sizeof(line), "%d. %s", index + 1, item.getName());
+    }
+    if (qty > 1 && len > 0 && len < (int)sizeof(line)) {
+        snprintf(line + len, sizeof(line) - len, " (x%d)", qty);
+    }
+    Serial.println(line);
+    
+    item.formatUseDescription(use, sizeof(use));
+    snprintf(line, sizeof(line), "   %s", use);
+    Serial.println(line);
 }
 
 // Display inventory
 void Inventory::displayInventory() const {
+    char line[40];
     Serial.println("=== INVENTORY ===");
-    Serial.println("Slots used: " + String(getItemCount()) + "/" + String(maxSlots));
+    snprintf(line, sizeof(line), "Slots used: %d/%d", slotCount, maxSlots);
+    Serial.println(line);
     
-    if (items.empty()) {
+    if (slotCount == 0) {
         Serial.println("Inventory is empty.");
         return;
     }
     
-    for (int i = 0; i < items.size(); i++) {
-        Item* item = items[i].item;
-        int qty = items[i].quantity;
-        
-        if (qty > 1) {
-            Serial.println(String(i + 1) + ". " + item->getDisplayName() + " (x" + String(qty) + ")");
-        } else {
-            Serial.println(String(i + 1) + ". " + item->getDisplayName());
-        }
-        Serial.println("   " + item->getUseDescription());
-        Serial.println("   Value: " + String(item->getGoldCost()) + " gold");
+    for (int i = 0; i < slotCount; i++) {
+        printItem(i, true);
+        snprintf(line, sizeof(line), "   Value: %d gold", Item(slots[i].itemID).getGoldCost());
+        Serial.println(line);
     }
 }
 
 // Display only consumables
 void Inventory::displayConsumables() const {
+    static const InventoryFilter CONSUMABLES = {1 << ITEM_CONSUMABLE, FILTER_ANY, FILTER_ANY};
     Serial.println("=== CONSUMABLES ===");
     
-    bool foundConsumables = false;
-    for (int i = 0; i < items.size(); i++) {
-        Item* item = items[i].item;
-        if (item->getType() == ITEM_CONSUMABLE) {
-            int qty = items[i].quantity;
-            foundConsumables = true;
-            
-            if (qty > 1) {
-                Serial.println(String(i + 1) + ". " + item->getName() + " (x" + String(qty) + ")");
-            } else {
-                Serial.println(String(i + 1) + ". " + item->getName());
-            }
-            Serial.println("   " + item->getUseDescription());
-        }
-    }
-    
-    if (!foundConsumables) {
+    InventoryQuery found;
+    if (query(CONSUMABLES, found) == 0) {
         Serial.println("No consumable items.");
+        return;
+    }
+    for (int i = 0; i < found.size(); i++) {
+        printItem(found[i], false);
     }
 }
 
 // Display equipped items
 void Inventory::displayEquipment() const {
+    char line[80];
+    char stats[48];
     Serial.println("=== EQUIPPED ITEMS ===");
     
-    if (equippedWeapon) {
-        Serial.println("Weapon: " + equippedWeapon->getDisplayName());
-        Serial.println("  " + equippedWeapon->getStatsDescription());
-    } else {
-        Serial.println("Weapon: None");
-    }
-    
-    if (equippedArmor) {
-        Serial.println("Armor: " + equippedArmor->getDisplayName());
-        Serial.println("  " + equippedArmor->getStatsDescription());
-    } else {
-        Serial.println("Armor: None");
-    }
-    
-    if (equippedAccessory) {
-        Serial.println("Accessory: " + equippedAccessory->getDisplayName());
-        Serial.println("  " + equippedAccessory->getStatsDescription());
-    } else {
-        Serial.println("Accessory: None");
+    for (int slot = 0; slot < EQUIPMENT_SLOT_COUNT; slot++) {
+        Item item(equipped[slot]);
+        if (item.isValid()) {
+            snprintf(line, sizeof(line), "%s: [%s] %s", Equipment::getSlotName(slot), item.getRarityName(), item.getName());
+            Serial.println(line);
+            Equipment::formatStats(item.getEntry(), stats, sizeof(stats));
+            snprintf(line, sizeof(line), "  %s", stats);
+            Serial.println(line);
+        } else {
+            snprintf(line, sizeof(line), "%s: None", Equipment::getSlotName(slot));
+            Serial.println(line);
+        }
     }
 }
 
-// Get inventory status string
-String Inventory::getInventoryStatus() const {
-    return "Inventory: " + String(getItemCount()) + "/" + String(maxSlots) + " slots";
+// Inventory status line
+void Inventory::formatStatus(char* out, int size) const {
+    snprintf(out, size, "Inventory: %d/%d slots", slotCount, maxSlots);
 }
 
 // Check if inventory has space for item
-bool Inventory::hasSpace(Item* item, int quantity) const {
-    if (!item) return false;
+bool Inventory::hasSpace(int itemID, int quantity) const {
+    const CatalogEntry* entry = ItemCatalog::find(itemID);
+    if (!entry) return false;
     
     // If stackable, check if we already have it
-    if (item->isStackable()) {
-        int existingIndex = findItemIndex(item->getID());
+    if (ItemCatalog::isStackable(*entry)) {
+        int existingIndex = findItemIndex(itemID);
         if (existingIndex != -1) {
             return true; // Can stack with existing
         }
@@ -321,42 +343,76 @@ bool Inventory::hasSpace(Item* item, int quantity) const {
     return getItemCount() < maxSlots;
 }
 
-// Sort inventory by type and rarity
+// Queries
+bool Inventory::matches(const CatalogEntry& entry, const InventoryFilter& filter) {
+    if (!(filter.typeMask & (1 << entry.type))) return false;
+    if (!(filter.rarityMask & (1 << entry.rarity))) return false;
+    if (entry.type == ITEM_EQUIPMENT && !(filter.slotMask & (1 << entry.slot))) return false;
+    return true;
+}
+
+uint32_t Inventory::getSortKey(int itemID) {
+    const CatalogEntry* entry = ItemCatalog::find(itemID);
+    if (!entry) return 0xFFFFFFFF;  // Unknown items last
+    return ((uint32_t)entry->type << 24) | ((uint32_t)(RARITY_EPIC - entry->rarity) << 16) | entry->itemID;
+}
+
+// One pass over the slots; each match is insertion-sorted into place
+// (at most MAX_INVENTORY_SLOTS entries, equal keys keep slot order)
+int Inventory::query(const InventoryFilter& filter, InventoryQuery& out) const {
+    out.count = 0;
+    for (int i = 0; i < slotCount; i++) {
+        const CatalogEntry* entry = ItemCatalog::find(slots[i].itemID);
+        if (!entry || !matches(*entry, filter)) continue;
+        
+        uint32_t key = getSortKey(entry->itemID);
+        int pos = out.count;
+        while (pos > 0 && getSortKey(slots[out.slots[pos - 1]].itemID) > key) {
+            out.slots[pos] = out.slots[pos - 1];
+            pos--;
+        }
+        out.slots[pos] = i;
+        out.count++;
+    }
+    return out.count;
+}
+
+// Sort slots in place by packed key (insertion sort - stable, and the
+// inventory is at most MAX_INVENTORY_SLOTS long)
 void Inventory::sortInventory() {
-    // Simple bubble sort for small inventories
-    for (int i = 0; i < items.size() - 1; i++) {
-        for (int j = 0; j < items.size() - i - 1; j++) {
-            Item* item1 = items[j].item;
-            Item* item2 = items[j + 1].item;
-            
-            // Sort by type first, then by rarity
-            if (item1->getType() > item2->getType() || 
-                (item1->getType() == item2->getType() && item1->getRarity() < item2->getRarity())) {
-                
-                // Swap slots
-                InventorySlot temp = items[j];
-                items[j] = items[j + 1];
-                items[j + 1] = temp;
-            }
+    for (int i = 1; i < slotCount; i++) {
+        InventorySlot slot = slots[i];
+        uint32_t key = getSortKey(slot.itemID);
+        int j = i;
+        while (j > 0 && getSortKey(slots[j - 1].itemID) > key) {
+            slots[j] = slots[j - 1];
+            j--;
         }
+        slots[j] = slot;
     }
+    stackItems();
 }
 
-// Destructor
-Inventory::~Inventory() {
-    // Clean up all items in inventory
-    for (auto& slot : items) {
-        if (slot.item) {
-            delete slot.item;
-            slot.item = nullptr;
+// Compact the slots, folding each stackable item into its first slot.
+// slotByItem is rebuilt as the compaction goes, so no scratch space is needed.
+int Inventory::stackItems() {
+    for (int i = 0; i < ITEM_CATALOG_SIZE; i++) {
+        slotByItem[i] = -1;
+    }
+    
+    int kept = 0;
+    for (int i = 0; i < slotCount; i++) {
+        InventorySlot slot = slots[i];
+        int row = ItemCatalog::indexOf(slot.itemID);
+        if (row >= 0 && slotByItem[row] >= 0 && ItemCatalog::isStackable(ItemCatalog::getEntry(row))) {
+            slots[slotByItem[row]].quantity += slot.quantity;
+            continue;
         }
+        if (row >= 0 && slotByItem[row] < 0) slotByItem[row] = kept;
+        slots[kept++] = slot;
     }
-    items.clear();
     
-    // Note: We don't delete equipped items here because they're the same objects
-    // as the ones in the items vector (just pointed to by equipped slots)
-    // Setting them to nullptr prevents dangling pointers
-    equippedWeapon = nullptr;
-    equippedArmor = nullptr;
-    equippedAccessory = nullptr;
+    int freed = slotCount - kept;
+    slotCount = kept;
+    return freed;
 }
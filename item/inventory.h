@@ -2,50 +2,93 @@
 #define INVENTORY_H
 
 #include "item.h"
-#include <vector>
+#include "../utils/constants.h"
 #include <Arduino.h>
 
 // Forward declarations
 class Player;
-class Equipment;
 
+// One inventory slot: which item (catalog ID) and how many. Everything
+// else about the item is read from the catalog.
 struct InventorySlot {
-    Item* item;
-    int quantity;
+    uint16_t itemID;
+    uint16_t quantity;
     
-    InventorySlot(Item* i, int qty = 1) : item(i), quantity(qty) {}
+    InventorySlot(int id = ITEM_ID_NONE, int qty = 1) : itemID(id), quantity(qty) {}
 };
 
+static_assert(sizeof(InventorySlot) == 4, "InventorySlot must stay a 4-byte handle");
+
+// Read-only view over the used slots (no copy - points into the Inventory)
+struct InventoryView {
+    const InventorySlot* data;
+    int count;
+    
+    const InventorySlot* begin() const { return data; }
+    const InventorySlot* end() const { return data + count; }
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+    const InventorySlot& operator[](int index) const { return data[index]; }
+};
+
+// Query filter: one bit per ItemType / ItemRarity / EquipmentSlot value
+// (bit n set = value n passes). The slot mask only applies to equipment.
+struct InventoryFilter {
+    uint8_t typeMask;
+    uint8_t rarityMask;
+    uint8_t slotMask;
+};
+
+static const uint8_t FILTER_ANY = 0xFF;
+static const InventoryFilter FILTER_ALL = {FILTER_ANY, FILTER_ANY, FILTER_ANY};
+
+// Query result: matching slot indices in sort-key order. Filled in place by
+// Inventory::query, so a filtered view is one pass with no heap or copies.
+struct InventoryQuery {
+    uint8_t slots[MAX_INVENTORY_SLOTS];
+    uint8_t count;
+    
+    int size() const { return count; }
+    bool empty() const { return count == 0; }
+    int operator[](int index) const { return slots[index]; }
+};
+
+// Fixed-capacity inventory: slots live inline (60 bytes), so the
+// Inventory never touches the heap
 class Inventory {
 private:
-    std::vector<InventorySlot> items;
-    int maxSlots;
+    InventorySlot slots[MAX_INVENTORY_SLOTS];
+    uint8_t slotCount;
+    uint8_t maxSlots;
+    
+    // First slot holding each catalog item (by catalog row), -1 if none
+    int8_t slotByItem[ITEM_CATALOG_SIZE];
     
-    // Equipment slots (for future equipment system)
-    Equipment* equippedWeapon;
-    Equipment* equippedArmor;
-    Equipment* equippedAccessory;
+    // Equipped item ID per EquipmentSlot (ITEM_ID_NONE = empty)
+    uint16_t equipped[EQUIPMENT_SLOT_COUNT];
     
     // Helper methods
     int findItemIndex(int itemID) const;
-    int findEmptySlot() const;
+    void rebuildIndex();
+    void printItem(int index, bool showRarity) const;
     
 public:
-    // Constructor
-    Inventory(int slots = 15);
+    // Constructor (capacity is capped at MAX_INVENTORY_SLOTS)
+    Inventory(int slots = MAX_INVENTORY_SLOTS);
     
     // Item management
-    bool addItem(Item* item, int quantity = 1);
+    bool addItem(int itemID, int quantity = 1);
     bool removeItem(int itemID, int quantity = 1);
     bool hasItem(int itemID, int quantity = 1) const;
-    Item* getItemByID(int itemID) const;
+    void clear();  // Drop everything, equipped items included
     
     // Inventory usage
     bool useItem(int inventoryIndex, Player* player);
     bool useItemByID(int itemID, Player* player);
     
     // Equipment management
-    bool equipOrUnequipItem(Equipment* equipment, Player* player);
+    bool equipOrUnequipItem(int itemID, Player* player);
+    bool isEquipped(int itemID) const;
     void displayEquipment() const;
     
     // Information
@@ -55,26 +98,33 @@ public:
     int getQuantity(int itemID) const;
     
     // Access
-    std::vector<InventorySlot> getItems() const;
-    Item* getItem(int index) const;
+    InventoryView getItems() const;
+    Item getItem(int index) const;
     int getSlotQuantity(int index) const;
     
-    // Equipment slots (for future use)
-    Equipment* getEquippedWeapon() const;
-    Equipment* getEquippedArmor() const;
-    Equipment* getEquippedAccessory() const;
+    // Equipped item IDs (ITEM_ID_NONE if the slot is empty)
+    int getEquippedID(int slot) const;
+    int getEquippedWeapon() const;
+    int getEquippedArmor() const;
+    int getEquippedAccessory() const;
+    int getLoadout() const;  // Packed equipped items (see ItemCatalog::getLoadout)
     
-    // Display
+    // Queries (filtered, sorted slot indices)
+    int query(const InventoryFilter& filter, InventoryQuery& out) const;
+    static bool matches(const CatalogEntry& entry, const InventoryFilter& filter);
+    
+    // Packed sort key: type, then rarity (best first), then catalog ID
+    static uint32_t getSortKey(int itemID);
+    
+    // Display (Serial, formatted into stack buffers)
     void displayInventory() const;
     void displayConsumables() const;
-    String getInventoryStatus() const;
+    void formatStatus(char* out, int size) const;
     
     // Utility
-    void sortInventory(); // Sort by item type and rarity
-    bool hasSpace(Item* item, int quantity = 1) const;
-    
-    // Cleanup
-    ~Inventory();
+    void sortInventory();  // Sort slots by key, then merge split stacks
+    int stackItems();      // Merge duplicate stackable slots, returns slots freed
+    bool hasSpace(int itemID, int quantity = 1) const;
 };
 
 #endif
@@ -1,136 +1,115 @@
 #include "item.h"
+#include "item_types/consumable.h"
+#include "item_types/equipment.h"
+#include "../entities/player.h"
+#include <stdio.h>
 
-// Constructor
-Item::Item(int id, String itemName, ItemType itemType) {
-    itemID = id;
-    name = itemName;
-    type = itemType;
-    rarity = RARITY_COMMON;
-    goldCost = 10;
-    sellValue = 5; // Default to 50% of cost
-    stackable = false;
-    description = "A mysterious item.";
+// Stand-in for invalid handles so getters never dereference null
+static constexpr CatalogEntry NO_ITEM = {ITEM_ID_NONE, ITEM_CONSUMABLE, RARITY_COMMON, 0, 0,
+                                         nullptr, 0, 0, 0, 0, 0, "Nothing", ""};
+
+// Constructors
+Item::Item() {
+    entry = nullptr;
+}
+
+Item::Item(int itemID) {
+    entry = ItemCatalog::find(itemID);
+}
+
+bool Item::isValid() const {
+    return entry != nullptr;
+}
+
+const CatalogEntry& Item::getEntry() const {
+    return entry ? *entry : NO_ITEM;
 }
 
 // Basic property getters
 int Item::getID() const {
-    return itemID;
+    return getEntry().itemID;
 }
 
-String Item::getName() const {
-    return name;
+const char* Item::getName() const {
+    return getEntry().name;
 }
 
-String Item::getDescription() const {
-    return description;
+const char* Item::getDescription() const {
+    return getEntry().description;
 }
 
 ItemType Item::getType() const {
-    return type;
+    return (ItemType)getEntry().type;
 }
 
 ItemRarity Item::getRarity() const {
-    return rarity;
+    return (ItemRarity)getEntry().rarity;
+}
+
+const char* Item::getRarityName() const {
+    return ItemCatalog::getRarityName(getEntry().rarity);
 }
 
 // Economic system
 int Item::getGoldCost() const {
-    return goldCost;
+    return ItemCatalog::getListPrice(getEntry());
 }
 
 int Item::getSellValue() const {
-    return sellValue;
+    return ItemCatalog::getSellValue(getEntry());
 }
 
-void Item::setGoldCost(int cost) {
-    if (cost >= 0) {
-        goldCost = cost;
-        sellValue = cost / 2; // Auto-set sell value to 50% of cost
-    }
+// Inventory properties
+bool Item::isStackable() const {
+    return ItemCatalog::isStackable(getEntry());
 }
 
-void Item::setSellValue(int value) {
-    if (value >= 0) {
-        sellValue = value;
+// Usage
+bool Item::use(Player* player) const {
+    if (!entry || !player) return false;
+    
+    // Gear toggles in the player's equipment slots
+    if (entry->type == ITEM_EQUIPMENT) {
+        return player->getInventory().equipOrUnequipItem(entry->itemID, player);
     }
+    return Consumable::use(*entry, player);
 }
 
-// Inventory properties
-bool Item::isStackable() const {
-    return stackable;
-}
-
-void Item::setStackable(bool canStack) {
-    stackable = canStack;
+String Item::getUseDescription() const {
+    char text[64];
+    formatUseDescription(text, sizeof(text));
+    return String(text);
 }
 
-// Rarity system
-void Item::setRarity(ItemRarity newRarity) {
-    rarity = newRarity;
+void Item::formatUseDescription(char* out, int size) const {
+    out[0] = '\0';
+    if (!entry) return;
     
-    // Adjust gold cost based on rarity
-    float multiplier = 1.0f;
-    switch(rarity) {
-        case RARITY_COMMON:
-            multiplier = 1.0f;
-            break;
-        case RARITY_UNCOMMON:
-            multiplier = 1.5f;
-            break;
-        case RARITY_RARE:
-            multiplier = 2.5f;
-            break;
-        case RARITY_EPIC:
-            multiplier = 4.0f;
-            break;
+    char detail[48];
+    if (entry->type == ITEM_EQUIPMENT) {
+        Equipment::formatStats(*entry, detail, sizeof(detail));
+        snprintf(out, size, "Use: Equip %s - %s", Equipment::getSlotName(entry->slot), detail);
+    } else {
+        Consumable::formatEffect(*entry, detail, sizeof(detail));
+        snprintf(out, size, "Use: %s", detail);
     }
-    
-    goldCost = (int)(goldCost * multiplier);
-    sellValue = goldCost / 2;
-}
-
-String Item::getRarityName() const {
-    switch(rarity) {
-        case RARITY_COMMON:
-            return "Common";
-        case RARITY_UNCOMMON:
-            return "Uncommon";
-        case RARITY_RARE:
-            return "Rare";
-        case RARITY_EPIC:
-            return "Epic";
-        default:
-            return "Unknown";
-    }
-}
-
-// Description system
-void Item::setDescription(String desc) {
-    description = desc;
 }
 
 // Display helpers
 String Item::getDisplayName() const {
-    // For now, just return name with rarity
-    // Later this could include color codes for display
-    return "[" + getRarityName() + "] " + name;
+    return String("[") + getRarityName() + "] " + getName();
 }
 
 String Item::getFullDescription() const {
     String fullDesc = getDisplayName() + "\n";
-    fullDesc += description + "\n";
-    fullDesc += "Value: " + String(goldCost) + " gold";
+    fullDesc += String(getDescription()) + "\n";
+    fullDesc += "Value: " + String(getGoldCost()) + " gold";
     
-    if (sellValue > 0) {
-        fullDesc += " (Sells for " + String(sellValue) + " gold)";
+    if (getSellValue() > 0) {
+        fullDesc += " (Sells for " + String(getSellValue()) + " gold)";
     }
     
     fullDesc += "\n" + getUseDescription();
     
     return fullDesc;
 }
-
-// Virtual destructor
-Item::~Item() {
-    // Base class cleanup (nothing to do for now)
-}
@@ -2,71 +2,49 @@
 #define ITEM_H
 
 #include <Arduino.h>
+#include "item_catalog.h"
 
 // Forward declaration to avoid circular includes
 class Player;
 
-enum ItemType {
-    ITEM_CONSUMABLE,
-    ITEM_EQUIPMENT
-};
-
-enum ItemRarity {
-    RARITY_COMMON,     // Basic items
-    RARITY_UNCOMMON,   // Slightly better
-    RARITY_RARE,       // Good items
-    RARITY_EPIC        // Best items
-};
-
+// Flyweight handle to one catalog item. Holds only a pointer into the
+// constant table, so it is free to copy and never allocates; all names,
+// prices and stats are read from flash.
 class Item {
-protected:
-    int itemID;
-    String name;
-    String description;
-    ItemType type;
-    ItemRarity rarity;
-    int goldCost;
-    int sellValue;
-    bool stackable;
+private:
+    const CatalogEntry* entry;  // nullptr = no item
     
 public:
-    // Constructor
-    Item(int id, String itemName, ItemType itemType);
+    // Constructors
+    Item();
+    explicit Item(int itemID);
+    
+    bool isValid() const;
+    const CatalogEntry& getEntry() const;
     
     // Basic properties
     int getID() const;
-    String getName() const;
-    String getDescription() const;
+    const char* getName() const;
+    const char* getDescription() const;
     ItemType getType() const;
     ItemRarity getRarity() const;
+    const char* getRarityName() const;
     
     // Economic system
     int getGoldCost() const;
     int getSellValue() const;
-    void setGoldCost(int cost);
-    void setSellValue(int value);
     
     // Inventory properties
     bool isStackable() const;
-    void setStackable(bool canStack);
-    
-    // Rarity system
-    void setRarity(ItemRarity newRarity);
-    String getRarityName() const;
     
-    // Description system
-    void setDescription(String desc);
+    // Usage (consumables apply their effect, equipment adds its bonuses)
+    bool use(Player* player) const;
+    String getUseDescription() const;
+    void formatUseDescription(char* out, int size) const;  // No allocation
     
-    // Usage (pure virtual - must be implemented by subclasses)
-    virtual bool use(Player* player) = 0;
-    virtual String getUseDescription() const = 0;
-    
-    // Display helpers
+    // Display helpers (Serial logging)
     String getDisplayName() const;
     String getFullDescription() const;
-    
-    // Virtual destructor for proper inheritance
-    virtual ~Item();
 };
 
 #endif
@@ -0,0 +1,257 @@
+#include "item_catalog.h"
+#include "../utils/constants.h"
+
+// Consumable effects (bytecode, see item_effects.h); boosts last 10 rooms
+static constexpr uint8_t FX_HEALTH_POTION[] = {FX_REQUIRE_HURT, FX_HEAL, POTION_HEAL_AMOUNT, FX_END};
+static constexpr uint8_t FX_GREATER_HEALTH_POTION[] = {FX_REQUIRE_HURT, FX_HEAL, 60, FX_END};
+static constexpr uint8_t FX_STRENGTH_POTION[] = {FX_BUFF, FX_STAT_ATTACK, 5, 10, FX_END};
+static constexpr uint8_t FX_DEFENSE_POTION[] = {FX_BUFF, FX_STAT_DEFENSE, 4, 10, FX_END};
+static constexpr uint8_t FX_SPEED_POTION[] = {FX_BUFF, FX_STAT_SPEED, 6, 10, FX_END};
+
+// Consumable and equipment rows (unused columns are 0)
+#define CONSUMABLE(id, rarity, cost, minFloor, effect, name, desc) \
+    {id, ITEM_CONSUMABLE, rarity, cost, minFloor, effect, 0, 0, 0, 0, 0, name, desc}
+#define GEAR(id, rarity, cost, minFloor, slot, hp, atk, def, spd, name, desc) \
+    {id, ITEM_EQUIPMENT, rarity, cost, minFloor, nullptr, slot, hp, atk, def, spd, name, desc}
+
+static constexpr CatalogEntry CATALOG[] = {
+    // Consumables
+    CONSUMABLE(ITEM_ID_HEALTH_POTION, RARITY_COMMON, HEALTH_POTION_COST, 1, FX_HEALTH_POTION,
+               "Health Potion", "A red potion that restores health when consumed."),
+    CONSUMABLE(ITEM_ID_GREATER_HEALTH_POTION, RARITY_UNCOMMON, 60, 2, FX_GREATER_HEALTH_POTION,
+               "Greater Health Potion", "A glowing red potion that restores significant health."),
+    CONSUMABLE(ITEM_ID_STRENGTH_POTION, RARITY_UNCOMMON, 75, 1, FX_STRENGTH_POTION,
+               "Strength Potion", "A bubbling orange potion that enhances physical power."),
+    CONSUMABLE(ITEM_ID_DEFENSE_POTION, RARITY_UNCOMMON, 70, 1, FX_DEFENSE_POTION,
+               "Defense Potion", "A metallic blue potion that hardens the skin."),
+    CONSUMABLE(ITEM_ID_SPEED_POTION, RARITY_UNCOMMON, 65, 1, FX_SPEED_POTION,
+               "Speed Potion", "A swirling green potion that makes you feel lighter."),
+    
+    // Weapons                                                 HP ATK DEF SPD
+    GEAR(ITEM_ID_RUSTY_DAGGER, RARITY_COMMON, 25, 1, SLOT_WEAPON,     0,  2,  0,  1,
+         "Rusty Dagger", "A worn dagger that's seen better days."),
+    GEAR(ITEM_ID_IRON_SWORD, RARITY_COMMON, 100, 1, SLOT_WEAPON,      0,  5,  0,  0,
+         "Iron Sword", "A sturdy iron blade favored by adventurers."),
+    GEAR(ITEM_ID_STEEL_SWORD, RARITY_UNCOMMON, 250, 3, SLOT_WEAPON,   0,  8,  1,  0,
+         "Steel Sword", "A well-crafted steel blade with excellent balance."),
+    
+    // Armor
+    GEAR(ITEM_ID_LEATHER_ARMOR, RARITY_COMMON, 60, 1, SLOT_ARMOR,    10,  0,  3,  0,
+         "Leather Armor", "Basic leather protection for novice adventurers."),
+    GEAR(ITEM_ID_CHAIN_MAIL, RARITY_COMMON, 150, 2, SLOT_ARMOR,      20,  0,  6, -1,
+         "Chain Mail", "Interlocked metal rings provide solid protection."),
+    GEAR(ITEM_ID_PLATE_ARMOR, RARITY_RARE, 400, 5, SLOT_ARMOR,       35,  0, 10, -2,
+         "Plate Armor", "Heavy steel plates offer maximum protection."),
+    
+    // Accessories
+    GEAR(ITEM_ID_SPEED_BOOTS, RARITY_UNCOMMON, 120, 2, SLOT_ACCESSORY, 0, 0,  0,  5,
+         "Speed Boots", "Enchanted boots that make you fleet of foot."),
+    GEAR(ITEM_ID_HEALTH_RING, RARITY_UNCOMMON, 180, 3, SLOT_ACCESSORY, 25, 0, 2,  0,
+         "Health Ring", "A magical ring that enhances vitality."),
+    GEAR(ITEM_ID_POWER_GLOVES, RARITY_UNCOMMON, 140, 3, SLOT_ACCESSORY, 0, 4, 0,  0,
+         "Power Gloves", "Gauntlets imbued with strength-enhancing magic.")
+};
+
+static const int CATALOG_SIZE = (int)(sizeof(CATALOG) / sizeof(CATALOG[0]));
+static_assert(CATALOG_SIZE == ITEM_CATALOG_SIZE, "Update ITEM_CATALOG_SIZE when adding items");
+
+// ID -> row without a search: rows are sorted by ID and each hundred-block
+// is numbered from 1 with no gaps, so the row is the block's first row plus
+// the offset inside the block.
+static const int ITEM_ID_BLOCK = 100;
+static const int ITEM_ID_BLOCK_COUNT = 4;
+static constexpr uint8_t BLOCK_FIRST_ROW[ITEM_ID_BLOCK_COUNT + 1] = {0, 5, 8, 11, 14};
+
+static constexpr bool rowsMatchBlocks(int row, int block) {
+    return row >= CATALOG_SIZE ? block == ITEM_ID_BLOCK_COUNT - 1 && BLOCK_FIRST_ROW[ITEM_ID_BLOCK_COUNT] == CATALOG_SIZE
+         : row >= BLOCK_FIRST_ROW[block + 1] ? rowsMatchBlocks(row, block + 1)
+         : CATALOG[row].itemID == block * ITEM_ID_BLOCK + (row - BLOCK_FIRST_ROW[block]) + 1 &&
+           rowsMatchBlocks(row + 1, block);
+}
+static_assert(rowsMatchBlocks(0, 0), "Catalog rows must be sorted by ID with no gaps inside each block");
+
+// Every consumable has a well-formed effect program; gear has none
+static constexpr bool effectsValid(int row) {
+    return row >= CATALOG_SIZE ? true
+         : ((CATALOG[row].type == ITEM_CONSUMABLE) == (CATALOG[row].effect != nullptr)) &&
+           isValidEffect(CATALOG[row].effect) && effectsValid(row + 1);
+}
+static_assert(effectsValid(0), "Bad item effect bytecode in the catalog");
+
+// Equipment sets. Pieces are item IDs, ITEM_ID_NONE = that slot doesn't matter.
+static constexpr int loadoutCode(int itemID) {
+    return itemID % ITEM_ID_BLOCK;
+}
+
+static constexpr uint8_t setMask(int weaponID, int armorID, int accessoryID) {
+    return (weaponID ? 3 : 0) | (armorID ? 3 << 2 : 0) | (accessoryID ? 3 << 4 : 0);
+}
+
+static constexpr uint8_t setPattern(int weaponID, int armorID, int accessoryID) {
+    return loadoutCode(weaponID) | (loadoutCode(armorID) << 2) | (loadoutCode(accessoryID) << 4);
+}
+
+#define EQUIPMENT_SET(name, weapon, armor, accessory, hp, atk, def, spd) \
+    {name, setMask(weapon, armor, accessory), setPattern(weapon, armor, accessory), hp, atk, def, spd}
+
+static constexpr EquipmentSet SETS[] = {
+    //                                                                              HP ATK DEF SPD
+    EQUIPMENT_SET("Knight's Oath", ITEM_ID_STEEL_SWORD, ITEM_ID_PLATE_ARMOR, ITEM_ID_NONE,      0, 2, 3, 0),
+    EQUIPMENT_SET("Brawler", ITEM_ID_IRON_SWORD, ITEM_ID_NONE, ITEM_ID_POWER_GLOVES,           0, 2, 0, 1),
+    EQUIPMENT_SET("Scout", ITEM_ID_RUSTY_DAGGER, ITEM_ID_LEATHER_ARMOR, ITEM_ID_SPEED_BOOTS,  0, 1, 1, 3),
+    EQUIPMENT_SET("Bulwark", ITEM_ID_NONE, ITEM_ID_CHAIN_MAIL, ITEM_ID_HEALTH_RING,          10, 0, 2, 0)
+};
+
+static const int SET_COUNT = (int)(sizeof(SETS) / sizeof(SETS[0]));
+static_assert(SET_COUNT <= 8, "LoadoutBonus::sets has one bit per set");
+
+// Gear must sit in the ID block after its slot (1xx weapon, 2xx armor,
+// 3xx accessory) at position 1-3, so a slot fits in 2 loadout bits
+static constexpr bool gearFitsLoadout(int row) {
+    return row >= CATALOG_SIZE ? true
+         : (CATALOG[row].type != ITEM_EQUIPMENT ||
+            (CATALOG[row].itemID / ITEM_ID_BLOCK == CATALOG[row].slot + 1 &&
+             loadoutCode(CATALOG[row].itemID) >= 1 && loadoutCode(CATALOG[row].itemID) <= 3)) &&
+           gearFitsLoadout(row + 1);
+}
+static_assert(gearFitsLoadout(0), "Gear IDs must match their slot's block and fit in 2 bits");
+static_assert(EQUIPMENT_SLOT_COUNT * LOADOUT_BITS_PER_SLOT == 6 && LOADOUT_COUNT == 64,
+              "Loadout table is sized for 3 slots of 2 bits");
+
+// Loadout table, built at compile time: item bonuses + matching sets
+static constexpr int slotCode(int loadout, int slot) {
+    return (loadout >> (slot * LOADOUT_BITS_PER_SLOT)) & 3;
+}
+
+static constexpr int gearBonus(const CatalogEntry& item, int stat) {
+    return stat == 0 ? item.hpBonus : stat == 1 ? item.attackBonus : stat == 2 ? item.defenseBonus : item.speedBonus;
+}
+
+static constexpr int setBonus(const EquipmentSet& set, int stat) {
+    return stat == 0 ? set.hpBonus : stat == 1 ? set.attackBonus : stat == 2 ? set.defenseBonus : set.speedBonus;
+}
+
+static constexpr int gearStat(int loadout, int slot, int stat) {
+    return slotCode(loadout, slot) == 0 ? 0
+         : gearBonus(CATALOG[BLOCK_FIRST_ROW[slot + 1] + slotCode(loadout, slot) - 1], stat);
+}
+
+static constexpr bool setActive(int set, int loadout) {
+    return (loadout & SETS[set].mask) == SETS[set].pattern;
+}
+
+static constexpr int setStat(int loadout, int stat, int set) {
+    return set >= SET_COUNT ? 0
+         : (setActive(set, loadout) ? setBonus(SETS[set], stat) : 0) + setStat(loadout, stat, set + 1);
+}
+
+static constexpr int loadoutStat(int loadout, int stat) {
+    return gearStat(loadout, SLOT_WEAPON, stat) + gearStat(loadout, SLOT_ARMOR, stat) +
+           gearStat(loadout, SLOT_ACCESSORY, stat) + setStat(loadout, stat, 0);
+}
+
+static constexpr int loadoutSets(int loadout, int set) {
+    return set >= SET_COUNT ? 0 : (setActive(set, loadout) ? 1 << set : 0) | loadoutSets(loadout, set + 1);
+}
+
+#define LOADOUT(i) {(int8_t)loadoutStat(i, 0), (int8_t)loadoutStat(i, 1), \
+                    (int8_t)loadoutStat(i, 2), (int8_t)loadoutStat(i, 3), (uint8_t)loadoutSets(i, 0)}
+#define LOADOUT4(i) LOADOUT(i), LOADOUT(i + 1), LOADOUT(i + 2), LOADOUT(i + 3)
+#define LOADOUT16(i) LOADOUT4(i), LOADOUT4(i + 4), LOADOUT4(i + 8), LOADOUT4(i + 12)
+
+static constexpr LoadoutBonus LOADOUTS[LOADOUT_COUNT] = {
+    LOADOUT16(0), LOADOUT16(16), LOADOUT16(32), LOADOUT16(48)
+};
+
+static_assert(LOADOUTS[0].hp == 0 && LOADOUTS[0].attack == 0 && LOADOUTS[0].sets == 0,
+              "Empty loadout gives nothing");
+static_assert(LOADOUTS[setPattern(ITEM_ID_STEEL_SWORD, ITEM_ID_PLATE_ARMOR, ITEM_ID_NONE)].sets == 1 &&
+              LOADOUTS[setPattern(ITEM_ID_STEEL_SWORD, ITEM_ID_PLATE_ARMOR, ITEM_ID_NONE)].defense == 1 + 10 + 3,
+              "Steel Sword + Plate Armor must add the Knight's Oath bonus");
+
+int ItemCatalog::getCount() {
+    return CATALOG_SIZE;
+}
+
+const CatalogEntry& ItemCatalog::getEntry(int index) {
+    if (index < 0 || index >= CATALOG_SIZE) index = 0;
+    return CATALOG[index];
+}
+
+int ItemCatalog::indexOf(int itemID) {
+    if (itemID <= 0) return -1;
+    int block = itemID / ITEM_ID_BLOCK;
+    int offset = itemID % ITEM_ID_BLOCK - 1;
+    if (block >= ITEM_ID_BLOCK_COUNT || offset < 0) return -1;
+    
+    int row = BLOCK_FIRST_ROW[block] + offset;
+    return (row < BLOCK_FIRST_ROW[block + 1]) ? row : -1;
+}
+
+const CatalogEntry* ItemCatalog::find(int itemID) {
+    int row = indexOf(itemID);
+    return (row >= 0) ? &CATALOG[row] : nullptr;
+}
+
+const char* ItemCatalog::getName(int itemID) {
+    const CatalogEntry* entry = find(itemID);
+    return entry ? entry->name : "Nothing";
+}
+
+// Rarity multipliers: x1, x1.5, x2.5, x4
+int ItemCatalog::getRarityPercent(int rarity) {
+    switch (rarity) {
+        case RARITY_UNCOMMON: return 150;
+        case RARITY_RARE:     return 250;
+        case RARITY_EPIC:     return 400;
+        default:              return 100;
+    }
+}
+
+const char* ItemCatalog::getRarityName(int rarity) {
+    switch (rarity) {
+        case RARITY_COMMON:   return "Common";
+        case RARITY_UNCOMMON: return "Uncommon";
+        case RARITY_RARE:     return "Rare";
+        case RARITY_EPIC:     return "Epic";
+        default:              return "Unknown";
+    }
+}
+
+int ItemCatalog::getListPrice(const CatalogEntry& entry) {
+    return entry.baseCost * getRarityPercent(entry.rarity) / 100;
+}
+
+int ItemCatalog::getSellValue(const CatalogEntry& entry) {
+    return getListPrice(entry) / 2;
+}
+
+bool ItemCatalog::isStackable(const CatalogEntry& entry) {
+    return entry.type == ITEM_CONSUMABLE;
+}
+
+// Loadouts
+int ItemCatalog::getLoadout(int weaponID, int armorID, int accessoryID) {
+    const int ids[EQUIPMENT_SLOT_COUNT] = {weaponID, armorID, accessoryID};
+    int loadout = 0;
+    for (int slot = 0; slot < EQUIPMENT_SLOT_COUNT; slot++) {
+        const CatalogEntry* item = find(ids[slot]);
+        if (item && item->type == ITEM_EQUIPMENT && item->slot == slot) {
+            loadout |= loadoutCode(item->itemID) << (slot * LOADOUT_BITS_PER_SLOT);
+        }
+    }
+    return loadout;
+}
+
+const LoadoutBonus& ItemCatalog::getLoadoutBonus(int loadout) {
+    return LOADOUTS[loadout & (LOADOUT_COUNT - 1)];
+}
+
+int ItemCatalog::getSetCount() {
+    return SET_COUNT;
+}
+
+const EquipmentSet& ItemCatalog::getSet(int index) {
+    if (index < 0 || index >= SET_COUNT) index = 0;
+    return SETS[index];
+}
@@ -0,0 +1,107 @@
+#ifndef ITEM_CATALOG_H
+#define ITEM_CATALOG_H
+
+#include <stdint.h>
+#include "item_ids.h"
+#include "item_effects.h"
+
+enum ItemType {
+    ITEM_CONSUMABLE,
+    ITEM_EQUIPMENT
+};
+
+enum ItemRarity {
+    RARITY_COMMON,     // Basic items
+    RARITY_UNCOMMON,   // Slightly better
+    RARITY_RARE,       // Good items
+    RARITY_EPIC        // Best items
+};
+
+enum EquipmentSlot {
+    SLOT_WEAPON,
+    SLOT_ARMOR,
+    SLOT_ACCESSORY
+};
+
+static const int EQUIPMENT_SLOT_COUNT = 3;
+
+// Rows in the catalog (checked against the table in item_catalog.cpp)
+static const int ITEM_CATALOG_SIZE = 14;
+
+// Everything about one kind of item. The table lives in flash; items in
+// the game are just IDs that point here.
+struct CatalogEntry {
+    uint16_t itemID;
+    uint8_t type;            // ItemType
+    uint8_t rarity;          // ItemRarity
+    uint16_t baseCost;       // Before the rarity multiplier
+    uint8_t minFloor;        // Shallowest floor a shop will stock it on
+    
+    // Consumables
+    const uint8_t* effect;   // Effect bytecode (see item_effects.h), nullptr for gear
+    
+    // Equipment
+    uint8_t slot;            // EquipmentSlot
+    int8_t hpBonus;
+    int8_t attackBonus;
+    int8_t defenseBonus;
+    int8_t speedBonus;
+    
+    const char* name;
+    const char* description;
+};
+
+// Equipped gear as one small number: 2 bits per EquipmentSlot holding the
+// item's position in its ID block (1-3, 0 = empty slot), so 4^3 loadouts
+static const int LOADOUT_BITS_PER_SLOT = 2;
+static const int LOADOUT_COUNT = 64;
+
+// Extra bonus for wearing specific pieces together
+struct EquipmentSet {
+    const char* name;
+    uint8_t mask;       // Loadout bits the set looks at
+    uint8_t pattern;    // Value those bits must have
+    int8_t hpBonus;
+    int8_t attackBonus;
+    int8_t defenseBonus;
+    int8_t speedBonus;
+};
+
+// Everything one loadout gives: item bonuses plus all matching sets
+struct LoadoutBonus {
+    int8_t hp;
+    int8_t attack;
+    int8_t defense;
+    int8_t speed;
+    uint8_t sets;       // Bit per active EquipmentSet
+};
+
+// Constant item table keyed by item ID (1-5 consumables, 101-303 gear)
+class ItemCatalog {
+public:
+    static int getCount();
+    static const CatalogEntry& getEntry(int index);
+    static const CatalogEntry* find(int itemID);  // nullptr if unknown
+    static int indexOf(int itemID);               // Catalog row, -1 if unknown (O(1))
+    
+    // Name by ID ("Nothing" for ITEM_ID_NONE or unknown IDs)
+    static const char* getName(int itemID);
+    
+    // Prices: base cost with the rarity multiplier, and half that back
+    static int getListPrice(const CatalogEntry& entry);
+    static int getSellValue(const CatalogEntry& entry);
+    static int getRarityPercent(int rarity);
+    static const char* getRarityName(int rarity);
+    
+    // Consumables stack, equipment doesn't
+    static bool isStackable(const CatalogEntry& entry);
+    
+    // Gear totals: pack the equipped IDs (one per slot, ITEM_ID_NONE = empty)
+    // into a loadout, then read its precomputed bonus
+    static int getLoadout(int weaponID, int armorID, int accessoryID);
+    static const LoadoutBonus& getLoadoutBonus(int loadout);
+    static int getSetCount();
+    static const EquipmentSet& getSet(int index);
+};
+
+#endif
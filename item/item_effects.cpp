@@ -0,0 +1,48 @@
+#include "item_effects.h"
+#include <stdio.h>
+
+static const char* STAT_LABELS[4] = {"HP", "ATK", "DEF", "SPD"};
+
+void ItemEffects::describe(const uint8_t* code, char* out, int size) {
+    int used = 0;
+    out[0] = '\0';
+    if (!code) return;
+    
+    for (int pc = 0; pc < FX_MAX_LENGTH && code[pc] != FX_END && code[pc] < FX_OP_COUNT; pc += 1 + FX_OPERANDS[code[pc]]) {
+        if (used >= size) break;
+        const char* sep = (used > 0) ? ", " : "";
+        
+        switch (code[pc]) {
+            case FX_HEAL:
+                used += snprintf(out + used, size - used, "%sRestore %d HP", sep, code[pc + 1]);
+                break;
+            case FX_BUFF:
+                used += snprintf(out + used, size - used, "%s%+d %s for %d rooms", sep, (int8_t)code[pc + 2],
+                                 STAT_LABELS[code[pc + 1] & 3], code[pc + 3]);
+                break;
+            case FX_CURE:
+                used += snprintf(out + used, size - used, "%sCure", sep);
+                break;
+            case FX_DAMAGE:
+                used += snprintf(out + used, size - used, "%sDeal %d damage", sep, code[pc + 1]);
+                break;
+            default:
+                break;  // Require ops don't show
+        }
+    }
+    
+    if (used == 0) {
+        snprintf(out, size, "No effect");
+    }
+}
+
+int ItemEffects::getLength(const uint8_t* code) {
+    if (!code) return 0;
+    
+    int pc = 0;
+    while (pc < FX_MAX_LENGTH && code[pc] < FX_OP_COUNT) {
+        if (code[pc] == FX_END) return pc + 1;
+        pc += 1 + FX_OPERANDS[code[pc]];
+    }
+    return 0;
+}
@@ -0,0 +1,125 @@
+#ifndef ITEM_EFFECTS_H
+#define ITEM_EFFECTS_H
+
+#include <stdint.h>
+
+// Item effect bytecode. Each consumable's catalog row points at a short
+// constant byte string; ItemEffects::run interprets it against a target.
+// New potions are new data, not new code.
+//
+//   FX_END                          stop
+//   FX_REQUIRE_HURT                 fail unless HP is below max
+//   FX_REQUIRE_ENEMY                fail unless there is an enemy to hit
+//   FX_HEAL    amount               restore HP
+//   FX_BUFF    stat amount rooms    timed stat change (amount is signed)
+//   FX_CURE                         remove active effects that lower a stat
+//   FX_DAMAGE  amount               damage the enemy
+//
+// Require ops must come before anything that changes state, so a failed
+// use leaves the target untouched (checked at compile time for the catalog).
+static const uint8_t FX_END = 0;
+static const uint8_t FX_REQUIRE_HURT = 1;
+static const uint8_t FX_REQUIRE_ENEMY = 2;
+static const uint8_t FX_HEAL = 3;
+static const uint8_t FX_BUFF = 4;
+static const uint8_t FX_CURE = 5;
+static const uint8_t FX_DAMAGE = 6;
+static const uint8_t FX_OP_COUNT = 7;
+
+// FX_BUFF stat operand
+static const uint8_t FX_STAT_HP = 0;
+static const uint8_t FX_STAT_ATTACK = 1;
+static const uint8_t FX_STAT_DEFENSE = 2;
+static const uint8_t FX_STAT_SPEED = 3;
+
+static const int FX_MAX_LENGTH = 16;  // Longest program, FX_END included
+
+// Operand bytes per opcode
+static constexpr uint8_t FX_OPERANDS[FX_OP_COUNT] = {0, 0, 0, 1, 3, 0, 1};
+
+enum EffectResult {
+    EFFECT_APPLIED,
+    EFFECT_NOT_NEEDED,   // FX_REQUIRE_HURT at full health
+    EFFECT_NO_TARGET,    // FX_REQUIRE_ENEMY outside combat
+    EFFECT_BAD_CODE
+};
+
+static constexpr bool isRequireOp(uint8_t op) {
+    return op == FX_REQUIRE_HURT || op == FX_REQUIRE_ENEMY;
+}
+
+// Compile-time check for catalog programs: known ops, valid stats, ends in
+// FX_END within FX_MAX_LENGTH, and no require op after a state change.
+// nullptr (no effect) is valid.
+static constexpr bool isValidEffect(const uint8_t* code, int pc = 0, bool changed = false) {
+    return code == nullptr ? true
+         : pc >= FX_MAX_LENGTH ? false
+         : code[pc] == FX_END ? true
+         : code[pc] >= FX_OP_COUNT ? false
+         : (isRequireOp(code[pc]) && changed) ? false
+         : (code[pc] == FX_BUFF && code[pc + 1] > FX_STAT_SPEED) ? false
+         : isValidEffect(code, pc + 1 + FX_OPERANDS[code[pc]], changed || !isRequireOp(code[pc]));
+}
+
+// Interpreter. Target is any type with:
+//   int getCurrentHP() const;  int getMaxHP() const;  void heal(int);
+//   void addEffect(int hp, int atk, int def, int spd, int rooms);
+//   void cureEffects();  bool hasEnemy() const;  void damageEnemy(int);
+// It is a template so the calls inline - no virtual dispatch, no allocation.
+class ItemEffects {
+public:
+    template <class Target>
+    static EffectResult run(const uint8_t* code, Target& target) {
+        if (!code) return EFFECT_BAD_CODE;
+        
+        int pc = 0;
+        while (pc < FX_MAX_LENGTH) {
+            uint8_t op = code[pc];
+            switch (op) {
+                case FX_END:
+                    return EFFECT_APPLIED;
+                case FX_REQUIRE_HURT:
+                    if (target.getCurrentHP() >= target.getMaxHP()) return EFFECT_NOT_NEEDED;
+                    break;
+                case FX_REQUIRE_ENEMY:
+                    if (!target.hasEnemy()) return EFFECT_NO_TARGET;
+                    break;
+                case FX_HEAL:
+                    target.heal(code[pc + 1]);
+                    break;
+                case FX_BUFF:
+                    applyBuff(target, code[pc + 1], (int8_t)code[pc + 2], code[pc + 3]);
+                    break;
+                case FX_CURE:
+                    target.cureEffects();
+                    break;
+                case FX_DAMAGE:
+                    target.damageEnemy(code[pc + 1]);
+                    break;
+                default:
+                    return EFFECT_BAD_CODE;
+            }
+            pc += 1 + FX_OPERANDS[op];
+        }
+        return EFFECT_BAD_CODE;  // Ran off the end without FX_END
+    }
+    
+    // Human-readable summary, e.g. "+5 ATK for 10 rooms" (no allocation)
+    static void describe(const uint8_t* code, char* out, int size);
+    
+    // Program length in bytes, FX_END included (0 if invalid)
+    static int getLength(const uint8_t* code);
+    
+private:
+    template <class Target>
+    static void applyBuff(Target& target, uint8_t stat, int amount, int rooms) {
+        switch (stat) {
+            case FX_STAT_HP:      target.addEffect(amount, 0, 0, 0, rooms); break;
+            case FX_STAT_ATTACK:  target.addEffect(0, amount, 0, 0, rooms); break;
+            case FX_STAT_DEFENSE: target.addEffect(0, 0, amount, 0, rooms); break;
+            case FX_STAT_SPEED:   target.addEffect(0, 0, 0, amount, rooms); break;
+        }
+    }
+};
+
+#endif
@@ -0,0 +1,27 @@
+#ifndef ITEM_IDS_H
+#define ITEM_IDS_H
+
+#include <stdint.h>
+
+// Item IDs: 1-99 consumables, 1xx weapons, 2xx armor, 3xx accessories
+static const uint16_t ITEM_ID_NONE = 0;   // Nothing (empty loot roll)
+
+static const uint16_t ITEM_ID_HEALTH_POTION = 1;
+static const uint16_t ITEM_ID_GREATER_HEALTH_POTION = 2;
+static const uint16_t ITEM_ID_STRENGTH_POTION = 3;
+static const uint16_t ITEM_ID_DEFENSE_POTION = 4;
+static const uint16_t ITEM_ID_SPEED_POTION = 5;
+
+static const uint16_t ITEM_ID_RUSTY_DAGGER = 101;
+static const uint16_t ITEM_ID_IRON_SWORD = 102;
+static const uint16_t ITEM_ID_STEEL_SWORD = 103;
+
+static const uint16_t ITEM_ID_LEATHER_ARMOR = 201;
+static const uint16_t ITEM_ID_CHAIN_MAIL = 202;
+static const uint16_t ITEM_ID_PLATE_ARMOR = 203;
+
+static const uint16_t ITEM_ID_SPEED_BOOTS = 301;
+static const uint16_t ITEM_ID_HEALTH_RING = 302;
+static const uint16_t ITEM_ID_POWER_GLOVES = 303;
+
+#endif
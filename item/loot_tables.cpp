@@ -0,0 +1,237 @@
+#include "loot_tables.h"
+
+// ==============================================
+// LOOT WEIGHTS
+// {item, min qty, max qty, weight} - weights are relative within a table
+// ==============================================
+
+// Treasure rooms: mostly potions early, better gear deeper down
+static constexpr LootEntry TREASURE_SHALLOW[] = {
+    {ITEM_ID_HEALTH_POTION,         1, 2, 40},
+    {ITEM_ID_GREATER_HEALTH_POTION, 1, 1, 10},
+    {ITEM_ID_STRENGTH_POTION,       1, 1, 8},
+    {ITEM_ID_DEFENSE_POTION,        1, 1, 8},
+    {ITEM_ID_SPEED_POTION,          1, 1, 8},
+    {ITEM_ID_RUSTY_DAGGER,          1, 1, 10},
+    {ITEM_ID_LEATHER_ARMOR,         1, 1, 10},
+    {ITEM_ID_IRON_SWORD,            1, 1, 3},
+    {ITEM_ID_SPEED_BOOTS,           1, 1, 3}
+};
+
+static constexpr LootEntry TREASURE_MIDDLE[] = {
+    {ITEM_ID_HEALTH_POTION,         1, 3, 25},
+    {ITEM_ID_GREATER_HEALTH_POTION, 1, 1, 20},
+    {ITEM_ID_STRENGTH_POTION,       1, 1, 10},
+    {ITEM_ID_DEFENSE_POTION,        1, 1, 10},
+    {ITEM_ID_SPEED_POTION,          1, 1, 10},
+    {ITEM_ID_IRON_SWORD,            1, 1, 8},
+    {ITEM_ID_CHAIN_MAIL,            1, 1, 8},
+    {ITEM_ID_STEEL_SWORD,           1, 1, 3},
+    {ITEM_ID_HEALTH_RING,           1, 1, 3},
+    {ITEM_ID_POWER_GLOVES,          1, 1, 3}
+};
+
+static constexpr LootEntry TREASURE_DEEP[] = {
+    {ITEM_ID_HEALTH_POTION,         2, 3, 15},
+    {ITEM_ID_GREATER_HEALTH_POTION, 1, 2, 25},
+    {ITEM_ID_STRENGTH_POTION,       1, 1, 10},
+    {ITEM_ID_DEFENSE_POTION,        1, 1, 10},
+    {ITEM_ID_SPEED_POTION,          1, 1, 10},
+    {ITEM_ID_STEEL_SWORD,           1, 1, 8},
+    {ITEM_ID_PLATE_ARMOR,           1, 1, 5},
+    {ITEM_ID_HEALTH_RING,           1, 1, 6},
+    {ITEM_ID_POWER_GLOVES,          1, 1, 6},
+    {ITEM_ID_SPEED_BOOTS,           1, 1, 5}
+};
+
+// Regular fights: usually nothing
+static constexpr LootEntry ENEMY_SHALLOW[] = {
+    {ITEM_ID_NONE,                  0, 0, 70},
+    {ITEM_ID_HEALTH_POTION,         1, 1, 25},
+    {ITEM_ID_RUSTY_DAGGER,          1, 1, 5}
+};
+
+static constexpr LootEntry ENEMY_MIDDLE[] = {
+    {ITEM_ID_NONE,                  0, 0, 65},
+    {ITEM_ID_HEALTH_POTION,         1, 1, 25},
+    {ITEM_ID_GREATER_HEALTH_POTION, 1, 1, 5},
+    {ITEM_ID_LEATHER_ARMOR,         1, 1, 5}
+};
+
+static constexpr LootEntry ENEMY_DEEP[] = {
+    {ITEM_ID_NONE,                  0, 0, 60},
+    {ITEM_ID_HEALTH_POTION,         1, 1, 20},
+    {ITEM_ID_GREATER_HEALTH_POTION, 1, 1, 15},
+    {ITEM_ID_CHAIN_MAIL,            1, 1, 5}
+};
+
+// Bosses: always drop something worthwhile
+static constexpr LootEntry BOSS_SHALLOW[] = {
+    {ITEM_ID_HEALTH_POTION,         2, 3, 40},
+    {ITEM_ID_IRON_SWORD,            1, 1, 30},
+    {ITEM_ID_LEATHER_ARMOR,         1, 1, 30}
+};
+
+static constexpr LootEntry BOSS_MIDDLE[] = {
+    {ITEM_ID_GREATER_HEALTH_POTION, 1, 2, 20},
+    {ITEM_ID_STEEL_SWORD,           1, 1, 25},
+    {ITEM_ID_CHAIN_MAIL,            1, 1, 25},
+    {ITEM_ID_HEALTH_RING,           1, 1, 15},
+    {ITEM_ID_POWER_GLOVES,          1, 1, 15}
+};
+
+static constexpr LootEntry BOSS_DEEP[] = {
+    {ITEM_ID_GREATER_HEALTH_POTION, 2, 3, 15},
+    {ITEM_ID_PLATE_ARMOR,           1, 1, 25},
+    {ITEM_ID_STEEL_SWORD,           1, 1, 20},
+    {ITEM_ID_HEALTH_RING,           1, 1, 15},
+    {ITEM_ID_POWER_GLOVES,          1, 1, 15},
+    {ITEM_ID_SPEED_BOOTS,           1, 1, 10}
+};
+
+#define TABLE_SIZE(table) ((int)(sizeof(table) / sizeof((table)[0])))
+
+struct LootTableSource {
+    const LootEntry* entries;
+    int count;
+};
+
+// [source][depth band]
+static constexpr LootTableSource LOOT_SOURCES[LOOT_SOURCE_COUNT][LOOT_DEPTH_BANDS] = {
+    {{TREASURE_SHALLOW, TABLE_SIZE(TREASURE_SHALLOW)},
+     {TREASURE_MIDDLE, TABLE_SIZE(TREASURE_MIDDLE)},
+     {TREASURE_DEEP, TABLE_SIZE(TREASURE_DEEP)}},
+    {{ENEMY_SHALLOW, TABLE_SIZE(ENEMY_SHALLOW)},
+     {ENEMY_MIDDLE, TABLE_SIZE(ENEMY_MIDDLE)},
+     {ENEMY_DEEP, TABLE_SIZE(ENEMY_DEEP)}},
+    {{BOSS_SHALLOW, TABLE_SIZE(BOSS_SHALLOW)},
+     {BOSS_MIDDLE, TABLE_SIZE(BOSS_MIDDLE)},
+     {BOSS_DEEP, TABLE_SIZE(BOSS_DEEP)}}
+};
+
+// Every table must fit the fixed-size alias arrays
+static constexpr bool tablesFit(int index) {
+    return index >= LOOT_SOURCE_COUNT * LOOT_DEPTH_BANDS ||
+           (LOOT_SOURCES[index / LOOT_DEPTH_BANDS][index % LOOT_DEPTH_BANDS].count <= LOOT_MAX_ENTRIES &&
+            tablesFit(index + 1));
+}
+static_assert(tablesFit(0), "Loot table larger than LOOT_MAX_ENTRIES");
+
+// Alias probabilities are 16-bit fractions; this one means "always keep"
+static const uint32_t ALIAS_ONE = 1u << 16;
+
+AliasTable LootTables::tables[LOOT_SOURCE_COUNT][LOOT_DEPTH_BANDS];
+bool LootTables::initialized = false;
+
+// ==============================================
+// TABLE SETUP
+// ==============================================
+
+void LootTables::init() {
+    if (initialized) return;
+    
+    for (int source = 0; source < LOOT_SOURCE_COUNT; source++) {
+        for (int band = 0; band < LOOT_DEPTH_BANDS; band++) {
+            const LootTableSource& src = LOOT_SOURCES[source][band];
+            buildAliasTable(src.entries, src.count, tables[source][band]);
+        }
+    }
+    initialized = true;
+}
+
+// Vose's alias method in integers. Each weight is scaled by the entry count,
+// so the average column holds exactly `total`. Columns below average get
+// topped up from one above average, which then moves to the other list if
+// it drops below. Every column ends up with at most two outcomes.
+void LootTables::buildAliasTable(const LootEntry* entries, int count, AliasTable& out) {
+    out.entries = entries;
+    out.count = (uint8_t)count;
+    
+    uint32_t total = 0;
+    for (int i = 0; i < count; i++) {
+        total += entries[i].weight;
+    }
+    
+    uint32_t scaled[LOOT_MAX_ENTRIES];
+    uint8_t small[LOOT_MAX_ENTRIES];
+    uint8_t large[LOOT_MAX_ENTRIES];
+    int smallCount = 0;
+    int largeCount = 0;
+    
+    for (int i = 0; i < count; i++) {
+        scaled[i] = (uint32_t)entries[i].weight * (uint32_t)count;
+        out.alias[i] = (uint8_t)i;
+        if (scaled[i] < total) {
+            small[smallCount++] = (uint8_t)i;
+        } else {
+            large[largeCount++] = (uint8_t)i;
+        }
+    }
+    
+    while (smallCount > 0 && largeCount > 0) {
+        int less = small[--smallCount];
+        int more = large[--largeCount];
+        
+        out.probability[less] = (uint32_t)(((uint64_t)scaled[less] << 16) / total);
+        out.alias[less] = (uint8_t)more;
+        
+        scaled[more] = scaled[more] + scaled[less] - total;
+        if (scaled[more] < total) {
+            small[smallCount++] = (uint8_t)more;
+        } else {
+            large[largeCount++] = (uint8_t)more;
+        }
+    }
+    
+    // Whatever is left is exactly average
+    while (largeCount > 0) out.probability[large[--largeCount]] = ALIAS_ONE;
+    while (smallCount > 0) out.probability[small[--smallCount]] = ALIAS_ONE;
+}
+
+// ==============================================
+// SAMPLING
+// ==============================================
+
+int LootTables::getDepthBand(int floorNumber) {
+    if (floorNumber <= 2) return 0;
+    if (floorNumber <= 5) return 1;
+    return 2;
+}
+
+const AliasTable& LootTables::getTable(LootSource source, int depthBand) {
+    init();
+    if (source < 0 || source >= LOOT_SOURCE_COUNT) source = LOOT_TREASURE;
+    if (depthBand < 0) depthBand = 0;
+    if (depthBand >= LOOT_DEPTH_BANDS) depthBand = LOOT_DEPTH_BANDS - 1;
+    return tables[source][depthBand];
+}
+
+uint32_t LootTables::getTotalWeight(const AliasTable& table) {
+    uint32_t total = 0;
+    for (int i = 0; i < table.count; i++) {
+        total += table.entries[i].weight;
+    }
+    return total;
+}
+
+LootDrop LootTables::roll(LootSource source, int floorNumber, Rng& rng) {
+    return rollFromTable(getTable(source, getDepthBand(floorNumber)), rng);
+}
+
+// One draw picks the column (high bits) and the coin flip (low 16 bits)
+LootDrop LootTables::rollFromTable(const AliasTable& table, Rng& rng) {
+    uint32_t draw = rng.nextBounded((uint32_t)table.count << 16);
+    int column = (int)(draw >> 16);
+    uint32_t fraction = draw & 0xFFFF;
+    
+    int index = (fraction < table.probability[column]) ? column : table.alias[column];
+    const LootEntry& entry = table.entries[index];
+    
+    LootDrop drop;
+    drop.itemID = entry.itemID;
+    drop.quantity = entry.minQuantity;
+    if (entry.maxQuantity > entry.minQuantity) {
+        drop.quantity = (uint8_t)rng.range(entry.minQuantity, entry.maxQuantity + 1);
+    }
+    return drop;
+}
@@ -0,0 +1,69 @@
+#ifndef LOOT_TABLES_H
+#define LOOT_TABLES_H
+
+#include <stdint.h>
+#include "item_ids.h"
+#include "../utils/rng.h"
+
+// Where the loot comes from
+enum LootSource {
+    LOOT_TREASURE = 0,   // Treasure rooms
+    LOOT_ENEMY = 1,      // Regular fights
+    LOOT_BOSS = 2,       // Boss fights
+    LOOT_SOURCE_COUNT = 3
+};
+
+// Floors are grouped into depth bands: 1-2, 3-5, 6+
+static const int LOOT_DEPTH_BANDS = 3;
+static const int LOOT_MAX_ENTRIES = 12;
+
+// One weighted line of a loot table
+struct LootEntry {
+    uint16_t itemID;     // ITEM_ID_NONE = no drop
+    uint8_t minQuantity;
+    uint8_t maxQuantity;
+    uint16_t weight;
+};
+
+// A single roll result
+struct LootDrop {
+    uint16_t itemID;
+    uint8_t quantity;
+};
+
+// Table compiled for O(1) sampling (Vose's alias method, 16.16 fixed point)
+struct AliasTable {
+    const LootEntry* entries;
+    uint8_t count;
+    uint32_t probability[LOOT_MAX_ENTRIES];  // Chance (out of 65536) to keep the column
+    uint8_t alias[LOOT_MAX_ENTRIES];         // Entry used otherwise
+};
+
+// Weighted loot tables per source and depth band. The weight tables are
+// constant data; init() compiles each into an alias table once, after which
+// every roll is one bounded RNG draw (plus one for the quantity).
+// Integer-only, so a seed gives the same loot on the ESP32 and on a host.
+class LootTables {
+public:
+    // Build every alias table (safe to call more than once)
+    static void init();
+    
+    static int getDepthBand(int floorNumber);
+    
+    // Roll one drop
+    static LootDrop roll(LootSource source, int floorNumber, Rng& rng);
+    static LootDrop rollFromTable(const AliasTable& table, Rng& rng);
+    
+    // Table access (for tools and the treasure screen)
+    static const AliasTable& getTable(LootSource source, int depthBand);
+    static uint32_t getTotalWeight(const AliasTable& table);
+    
+    // Compile a weight list into an alias table
+    static void buildAliasTable(const LootEntry* entries, int count, AliasTable& out);
+    
+private:
+    static AliasTable tables[LOOT_SOURCE_COUNT][LOOT_DEPTH_BANDS];
+    static bool initialized;
+};
+
+#endif
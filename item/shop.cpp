@@ -0,0 +1,113 @@
+#include "shop.h"
+
+// Pricing knobs (percent)
+static const int SHOP_FLOOR_MARKUP = 8;        // Per floor below the first
+static const int SHOP_SCARCITY_MARKUP = 15;    // Per unit already bought
+static const int SHOP_SELL_BACK = 40;          // Share of the floor price paid for a sale
+static const int SHOP_SELL_DECAY = 5;          // Less per unit already sold
+static const int SHOP_SELL_MIN = 15;           // Floor for the sell share
+
+// Stock sizes
+static const int SHOP_POTION_STOCK_MIN = 3;
+static const int SHOP_POTION_STOCK_MAX = 5;
+static const int SHOP_CONSUMABLE_STOCK_MAX = 2;
+static const int SHOP_MAX_CANDIDATES = 32;
+
+// Deeper floors shift stock toward rarer items
+int ShopGen::getRarityWeight(int rarity, int floorNumber) {
+    switch (rarity) {
+        case RARITY_COMMON:   return 40;
+        case RARITY_UNCOMMON: return 15 + 5 * floorNumber;
+        case RARITY_RARE:     return 5 * floorNumber;
+        default:              return 0; // Epic items are never sold
+    }
+}
+
+int ShopGen::getFloorPrice(const CatalogEntry& entry, int floorNumber) {
+    int floors = (floorNumber > 1) ? floorNumber - 1 : 0;
+    return ItemCatalog::getListPrice(entry) * (100 + SHOP_FLOOR_MARKUP * floors) / 100;
+}
+
+int ShopGen::computeBuyPrice(const ShopSlot& slot, int floorNumber) {
+    const CatalogEntry* entry = ItemCatalog::find(slot.itemID);
+    if (!entry) return 0;
+    return getFloorPrice(*entry, floorNumber) * (100 + SHOP_SCARCITY_MARKUP * slot.bought) / 100;
+}
+
+// Slot 0 is always health potions; the rest are distinct catalog items
+// drawn by rarity weight from what this floor allows.
+void ShopGen::generate(ShopStock& shop, int floorNumber, uint32_t seed) {
+    Rng rng(seed);
+    shop.slotCount = 0;
+    shop.floorNumber = (uint8_t)floorNumber;
+    shop.itemsSold = 0;
+    
+    ShopSlot& potions = shop.slots[shop.slotCount++];
+    potions.itemID = ITEM_ID_HEALTH_POTION;
+    potions.stock = (uint8_t)rng.range(SHOP_POTION_STOCK_MIN, SHOP_POTION_STOCK_MAX + 1);
+    potions.bought = 0;
+    potions.price = (uint16_t)computeBuyPrice(potions, floorNumber);
+    
+    // Candidate weights (0 = not offered / already picked)
+    int weights[SHOP_MAX_CANDIDATES];
+    int candidates = ItemCatalog::getCount();
+    if (candidates > SHOP_MAX_CANDIDATES) candidates = SHOP_MAX_CANDIDATES;
+    int totalWeight = 0;
+    for (int i = 0; i < candidates; i++) {
+        const CatalogEntry& entry = ItemCatalog::getEntry(i);
+        bool allowed = entry.itemID != ITEM_ID_HEALTH_POTION && entry.minFloor <= floorNumber;
+        weights[i] = allowed ? getRarityWeight(entry.rarity, floorNumber) : 0;
+        totalWeight += weights[i];
+    }
+    
+    while (shop.slotCount < SHOP_MAX_SLOTS && totalWeight > 0) {
+        int pick = (int)rng.nextBounded((uint32_t)totalWeight);
+        int index = 0;
+        while (pick >= weights[index]) {
+            pick -= weights[index];
+            index++;
+        }
+        
+        const CatalogEntry& entry = ItemCatalog::getEntry(index);
+        totalWeight -= weights[index];
+        weights[index] = 0;
+        
+        ShopSlot& slot = shop.slots[shop.slotCount++];
+        slot.itemID = entry.itemID;
+        slot.stock = (entry.type == ITEM_CONSUMABLE) ? (uint8_t)rng.range(1, SHOP_CONSUMABLE_STOCK_MAX + 1) : 1;
+        slot.bought = 0;
+        slot.price = (uint16_t)computeBuyPrice(slot, floorNumber);
+    }
+}
+
+int ShopGen::getBuyPrice(const ShopStock& shop, int slotIndex) {
+    if (slotIndex < 0 || slotIndex >= shop.slotCount) return 0;
+    return shop.slots[slotIndex].price;
+}
+
+int ShopGen::getSellPrice(const ShopStock& shop, int itemID) {
+    const CatalogEntry* entry = ItemCatalog::find(itemID);
+    if (!entry) return 0;
+    
+    int share = SHOP_SELL_BACK - SHOP_SELL_DECAY * shop.itemsSold;
+    if (share < SHOP_SELL_MIN) share = SHOP_SELL_MIN;
+    
+    int price = getFloorPrice(*entry, shop.floorNumber) * share / 100;
+    return (price > 0) ? price : 1;
+}
+
+bool ShopGen::recordPurchase(ShopStock& shop, int slotIndex) {
+    if (slotIndex < 0 || slotIndex >= shop.slotCount) return false;
+    
+    ShopSlot& slot = shop.slots[slotIndex];
+    if (slot.stock == 0) return false;
+    
+    slot.stock--;
+    slot.bought++;
+    slot.price = (uint16_t)computeBuyPrice(slot, shop.floorNumber);
+    return true;
+}
+
+void ShopGen::recordSale(ShopStock& shop) {
+    if (shop.itemsSold < 255) shop.itemsSold++;
+}
@@ -0,0 +1,50 @@
+#ifndef SHOP_H
+#define SHOP_H
+
+#include <stdint.h>
+#include "item_catalog.h"
+#include "../utils/rng.h"
+
+static const int SHOP_MAX_SLOTS = 5;
+
+// One line of shop stock. Price is kept current so redraws just read it.
+struct ShopSlot {
+    uint16_t itemID;
+    uint16_t price;    // Current buy price
+    uint8_t stock;     // Units left
+    uint8_t bought;    // Units the player has bought (drives scarcity)
+};
+
+// Everything a shop room sells, built once when the room is generated
+struct ShopStock {
+    ShopSlot slots[SHOP_MAX_SLOTS];
+    uint8_t slotCount;
+    uint8_t floorNumber;
+    uint8_t itemsSold;     // Units sold back to this shop (lowers the next offer)
+};
+
+// Shop stock generation and pricing. Pure integer code over the item
+// catalog: no heap, no Arduino, same stock for the same seed everywhere.
+//
+// Buy price  = list price * floor markup * scarcity (each unit bought)
+// Sell price = a share of the floor-scaled list price, dropping with
+//              every unit already sold to this shop
+class ShopGen {
+public:
+    static void generate(ShopStock& shop, int floorNumber, uint32_t seed);
+    
+    // Pricing
+    static int getBuyPrice(const ShopStock& shop, int slotIndex);
+    static int getSellPrice(const ShopStock& shop, int itemID);
+    
+    // Record a purchase (false if sold out); gold is handled by the caller
+    static bool recordPurchase(ShopStock& shop, int slotIndex);
+    static void recordSale(ShopStock& shop);
+    
+private:
+    static int getFloorPrice(const CatalogEntry& entry, int floorNumber);
+    static int getRarityWeight(int rarity, int floorNumber);
+    static int computeBuyPrice(const ShopSlot& slot, int floorNumber);
+};
+
+#endif
@@ -1,6 +1,6 @@
 #include "CombatMenu.h"
 
-CombatMenu::CombatMenu(Display* disp, Input* inp) : MenuBase(disp, inp, 3) {
+CombatMenu::CombatMenu(Display* disp, Input* inp) : MenuBase(disp, inp, 4) {
     lastRenderedSelection = -1;
     needsRedraw = true;
 }
@@ -32,7 +32,7 @@ void CombatMenu::drawMenuArea() {
     
     // Menu positioned at bottom of screen
     int yStart = 260;
-    int xSpacing = 50;
+    int xSpacing = 40;
     
     for (int i = 0; i < maxOptions; i++) {
         int xPos = 10 + (i * xSpacing);
@@ -40,7 +40,7 @@ void CombatMenu::drawMenuArea() {
         // Highlight selected option
         if (i == selectedOption) {
             // Draw selection box
-            display->fillRect(xPos - 2, yStart - 2, 44, 20, TFT_YELLOW);
+            display->fillRect(xPos - 2, yStart - 2, 40, 20, TFT_YELLOW);
             display->drawText(menuOptions[i], xPos, yStart, TFT_BLACK, 1);
         } else {
             // Draw unselected option
@@ -6,12 +6,13 @@
 enum class CombatAction {
     ATTACK = 0,
     DEFEND = 1,
-    ITEM = 2
+    ITEM = 2,
+    AUTO = 3
 };
 
 class CombatMenu : public MenuBase {
 private:
-    const char* menuOptions[3] = {"Attack", "Defend", "Item"};
+    const char* menuOptions[4] = {"Attack", "Defend", "Item", "Auto"};
     int lastRenderedSelection;
     bool needsRedraw;
     
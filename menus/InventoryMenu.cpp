@@ -0,0 +1,329 @@
+#include "InventoryMenu.h"
+#include "../entities/player.h"
+#include "../item/item_types/consumable.h"
+#include "../item/item_types/equipment.h"
+#include <stdio.h>
+
+// Filter tabs, cycled with A while the tab row is focused
+struct FilterTab {
+    const char* label;
+    InventoryFilter filter;
+};
+
+static const FilterTab FILTER_TABS[] = {
+    {"All",         {FILTER_ANY, FILTER_ANY, FILTER_ANY}},
+    {"Potions",     {1 << ITEM_CONSUMABLE, FILTER_ANY, FILTER_ANY}},
+    {"Weapons",     {1 << ITEM_EQUIPMENT, FILTER_ANY, 1 << SLOT_WEAPON}},
+    {"Armor",       {1 << ITEM_EQUIPMENT, FILTER_ANY, 1 << SLOT_ARMOR}},
+    {"Accessories", {1 << ITEM_EQUIPMENT, FILTER_ANY, 1 << SLOT_ACCESSORY}},
+    {"Rare+",       {FILTER_ANY, (1 << RARITY_RARE) | (1 << RARITY_EPIC), FILTER_ANY}}
+};
+static const int FILTER_TAB_COUNT = sizeof(FILTER_TABS) / sizeof(FILTER_TABS[0]);
+
+InventoryMenu::InventoryMenu(Display* disp, Input* inp, Player* p) : MenuBase(disp, inp, 0) {
+    player = p;
+    view.count = 0;
+    filterIndex = 0;
+    tabFocused = false;
+    scrollTop = 0;
+    frameDrawn = false;
+    statusDirty = true;
+    tabDirty = true;
+    detailDirty = true;
+    lastDetailSelection = -1;
+    invalidateRows();
+}
+
+void InventoryMenu::activate() {
+    MenuBase::activate();
+    tabFocused = false;
+    scrollTop = 0;
+    frameDrawn = false;
+    refresh();
+}
+
+void InventoryMenu::refresh() {
+    runQuery();
+    if (selectedOption >= maxOptions) selectedOption = maxOptions - 1;
+    if (selectedOption < 0) selectedOption = 0;
+    if (maxOptions == 0) tabFocused = true;
+    keepSelectionVisible();
+    statusDirty = true;
+    tabDirty = true;
+    detailDirty = true;
+}
+
+// Rebuild the list for the current filter (sorted, one pass over the slots)
+void InventoryMenu::runQuery() {
+    maxOptions = player->getInventory().query(FILTER_TABS[filterIndex].filter, view);
+}
+
+uint16_t InventoryMenu::getRarityColor(int rarity) {
+    switch (rarity) {
+        case RARITY_UNCOMMON: return TFT_GREEN;
+        case RARITY_RARE:     return TFT_CYAN;
+        case RARITY_EPIC:     return TFT_MAGENTA;
+        default:              return TFT_WHITE;
+    }
+}
+
+// Row cache
+InventoryRowKey InventoryMenu::buildRowKey(int row) const {
+    InventoryRowKey key = {ITEM_ID_NONE, 0, 0};
+    const Inventory& inventory = player->getInventory();
+    int index = scrollTop + row;
+    
+    if (index < maxOptions) {
+        const InventorySlot& slot = inventory.getItems()[view[index]];
+        key.itemID = slot.itemID;
+        key.quantity = slot.quantity;
+        if (index == selectedOption && !tabFocused) key.flags |= ROW_SELECTED;
+        if (inventory.isEquipped(slot.itemID)) key.flags |= ROW_EQUIPPED;
+    }
+    if (row == 0 && scrollTop > 0) key.flags |= ROW_MORE_ABOVE;
+    if (row == VISIBLE_ROWS - 1 && scrollTop + VISIBLE_ROWS < maxOptions) key.flags |= ROW_MORE_BELOW;
+    return key;
+}
+
+void InventoryMenu::keepSelectionVisible() {
+    if (selectedOption < scrollTop) {
+        scrollTop = selectedOption;
+    } else if (selectedOption >= scrollTop + VISIBLE_ROWS) {
+        scrollTop = selectedOption - VISIBLE_ROWS + 1;
+    }
+    if (scrollTop < 0) scrollTop = 0;
+}
+
+void InventoryMenu::invalidateRows() {
+    for (int i = 0; i < VISIBLE_ROWS; i++) {
+        rowCache[i].itemID = ITEM_ID_NONE;
+        rowCache[i].quantity = 0;
+        rowCache[i].flags = ROW_INVALID;
+    }
+}
+
+void InventoryMenu::render() {
+    if (!isActive) return;
+    
+    if (!frameDrawn) {
+        drawFrame();
+        invalidateRows();
+        statusDirty = true;
+        detailDirty = true;
+        frameDrawn = true;
+    }
+    
+    if (statusDirty) {
+        drawStatusLine();
+        statusDirty = false;
+    }
+    
+    if (tabDirty) {
+        drawFilterTab();
+        tabDirty = false;
+    }
+    
+    // Redraw only the rows whose contents changed
+    for (int row = 0; row < VISIBLE_ROWS; row++) {
+        InventoryRowKey key = buildRowKey(row);
+        const InventoryRowKey& cached = rowCache[row];
+        if (key.itemID != cached.itemID || key.quantity != cached.quantity || key.flags != cached.flags) {
+            drawRow(row, key);
+            rowCache[row] = key;
+        }
+    }
+    
+    if (detailDirty || selectedOption != lastDetailSelection) {
+        drawDetail();
+        lastDetailSelection = selectedOption;
+        detailDirty = false;
+    }
+}
+
+// Drawing
+void InventoryMenu::drawFrame() {
+    display->clear();
+    display->drawText("Inventory", 30, 8, TFT_YELLOW, 2);
+    display->drawLine(0, LIST_Y - 3, Display::WIDTH, LIST_Y - 3, TFT_DARKGREY);
+    display->drawLine(0, DETAIL_Y - 3, Display::WIDTH, DETAIL_Y - 3, TFT_DARKGREY);
+    display->drawText("A: Use/Equip  B: Back", 10, 300, TFT_CYAN, 1);
+}
+
+void InventoryMenu::drawStatusLine() {
+    char text[32];
+    display->fillRect(0, 28, Display::WIDTH, 12, TFT_BLACK);
+    snprintf(text, sizeof(text), "HP %d/%d", player->getCurrentHP(), player->getMaxHP());
+    display->drawText(text, 5, 30, TFT_WHITE);
+    const Inventory& inventory = player->getInventory();
+    snprintf(text, sizeof(text), "%d/%d slots", inventory.getItemCount(), inventory.getMaxSlots());
+    display->drawText(text, 95, 30, TFT_LIGHTGREY);
+}
+
+void InventoryMenu::drawFilterTab() {
+    char text[32];
+    uint16_t bg = tabFocused ? TFT_BLUE : TFT_BLACK;
+    display->fillRect(0, TAB_Y, Display::WIDTH, ROW_HEIGHT - 2, bg);
+    snprintf(text, sizeof(text), "< %s (%d) >", FILTER_TABS[filterIndex].label, maxOptions);
+    display->drawText(text, 5, TAB_Y + 4, tabFocused ? TFT_YELLOW : TFT_LIGHTGREY, bg, 1);
+}
+
+void InventoryMenu::drawRow(int row, const InventoryRowKey& key) {
+    int y = LIST_Y + row * ROW_HEIGHT;
+    uint16_t bg = (key.flags & ROW_SELECTED) ? TFT_BLUE : TFT_BLACK;
+    display->fillRect(0, y, Display::WIDTH, ROW_HEIGHT, bg);
+    
+    const CatalogEntry* item = ItemCatalog::find(key.itemID);
+    if (item) {
+        if (key.flags & ROW_EQUIPPED) {
+            display->drawText("E", 4, y + 5, TFT_YELLOW, bg, 1);
+        }
+        display->drawText(item->name, 14, y + 5, getRarityColor(item->rarity), bg, 1);
+        
+        if (key.quantity > 1) {
+            char text[8];
+            snprintf(text, sizeof(text), "x%d", key.quantity);
+            display->drawText(text, 142, y + 5, TFT_WHITE, bg, 1);
+        }
+    }
+    
+    // Scroll hints in the corner of the first/last row
+    if (key.flags & ROW_MORE_ABOVE) display->drawText("^", 163, y + 5, TFT_CYAN, bg, 1);
+    if (key.flags & ROW_MORE_BELOW) display->drawText("v", 163, y + 5, TFT_CYAN, bg, 1);
+}
+
+void InventoryMenu::drawDetail() {
+    display->fillRect(0, DETAIL_Y, Display::WIDTH, DETAIL_HEIGHT, TFT_BLACK);
+    
+    if (maxOptions == 0) {
+        const char* text = (filterIndex == 0) ? "Your pack is empty." : "Nothing here. A: next filter";
+        display->drawText(text, 5, DETAIL_Y + 2, TFT_DARKGREY);
+        return;
+    }
+    
+    const CatalogEntry* item = ItemCatalog::find(player->getInventory().getItems()[view[selectedOption]].itemID);
+    if (!item) return;
+    
+    char text[48];
+    display->drawText(item->name, 5, DETAIL_Y + 2, getRarityColor(item->rarity));
+    
+    if (item->type == ITEM_EQUIPMENT) {
+        drawComparison(*item, DETAIL_Y + 13);
+        return;
+    }
+    
+    Consumable::formatEffect(*item, text, sizeof(text));
+    display->drawText(text, 5, DETAIL_Y + 13, TFT_WHITE);
+}
+
+// Gear totals (items + set bonuses) now vs after pressing A on this item
+void InventoryMenu::drawComparison(const CatalogEntry& item, int y) {
+    const Inventory& inventory = player->getInventory();
+    int equippedIDs[EQUIPMENT_SLOT_COUNT];
+    for (int slot = 0; slot < EQUIPMENT_SLOT_COUNT; slot++) {
+        equippedIDs[slot] = inventory.getEquippedID(slot);
+    }
+    const CatalogEntry* current = ItemCatalog::find(equippedIDs[item.slot]);
+    char text[40];
+    
+    if (current == &item) {
+        snprintf(text, sizeof(text), "%s - A to remove", Equipment::getSlotName(item.slot));
+        display->drawText(text, 5, y, TFT_YELLOW);
+        equippedIDs[item.slot] = ITEM_ID_NONE;
+    } else {
+        if (current) {
+            snprintf(text, sizeof(text), "vs %s", current->name);
+        } else {
+            snprintf(text, sizeof(text), "%s slot is empty", Equipment::getSlotName(item.slot));
+        }
+        display->drawText(text, 5, y, TFT_LIGHTGREY);
+        equippedIDs[item.slot] = item.itemID;
+    }
+    y += 11;
+    
+    const LoadoutBonus& now = ItemCatalog::getLoadoutBonus(inventory.getLoadout());
+    const LoadoutBonus& after = ItemCatalog::getLoadoutBonus(
+        ItemCatalog::getLoadout(equippedIDs[SLOT_WEAPON], equippedIDs[SLOT_ARMOR], equippedIDs[SLOT_ACCESSORY]));
+    
+    const char* labels[4] = {"HP", "ATK", "DEF", "SPD"};
+    const int before[4] = {now.hp, now.attack, now.defense, now.speed};
+    const int changed[4] = {after.hp, after.attack, after.defense, after.speed};
+    
+    for (int i = 0; i < 4; i++) {
+        if (before[i] == 0 && changed[i] == 0) continue;
+        int delta = changed[i] - before[i];
+        uint16_t color = (delta > 0) ? TFT_GREEN : (delta < 0) ? TFT_RED : TFT_WHITE;
+        snprintf(text, sizeof(text), "%-3s %+3d -> %+3d  (%+d)", labels[i], before[i], changed[i], delta);
+        display->drawText(text, 5, y, color);
+        y += 11;
+    }
+    
+    // First set this would complete or break
+    for (int set = 0; set < ItemCatalog::getSetCount(); set++) {
+        bool wasActive = (now.sets >> set) & 1;
+        bool isActive = (after.sets >> set) & 1;
+        if (wasActive == isActive) continue;
+        snprintf(text, sizeof(text), "%s set: %s", isActive ? "+" : "-", ItemCatalog::getSet(set).name);
+        display->drawText(text, 5, y, isActive ? TFT_GREEN : TFT_RED);
+        break;
+    }
+}
+
+MenuResult InventoryMenu::handleInput() {
+    if (!isActive) return MenuResult::NONE;
+    
+    // Handle cancel
+    if (input->wasPressed(Button::B)) {
+        return MenuResult::CANCELLED;
+    }
+    
+    // Filter tab: A cycles the filter, UP/DOWN drop back into the list
+    if (tabFocused) {
+        if (input->wasPressed(Button::A)) {
+            filterIndex = (filterIndex + 1) % FILTER_TAB_COUNT;
+            selectedOption = 0;
+            scrollTop = 0;
+            refresh();
+            return MenuResult::NONE;
+        }
+        if (maxOptions == 0) return MenuResult::NONE;
+        
+        if (input->wasPressed(Button::DOWN)) {
+            selectedOption = 0;
+        } else if (input->wasPressed(Button::UP)) {
+            selectedOption = maxOptions - 1;
+        } else {
+            return MenuResult::NONE;
+        }
+        tabFocused = false;
+        tabDirty = true;
+        keepSelectionVisible();
+        return MenuResult::NONE;
+    }
+    
+    // Handle navigation (the list scrolls to follow the cursor, UP from
+    // the first row moves to the filter tab)
+    if (input->wasPressed(Button::UP)) {
+        if (selectedOption == 0) {
+            tabFocused = true;
+            tabDirty = true;
+            return MenuResult::NONE;
+        }
+        moveSelectionUp();
+        keepSelectionVisible();
+        return MenuResult::NONE;
+    }
+    
+    if (input->wasPressed(Button::DOWN)) {
+        moveSelectionDown();
+        keepSelectionVisible();
+        return MenuResult::NONE;
+    }
+    
+    // Handle selection
+    if (input->wasPressed(Button::A)) {
+        selectionMade = view[selectedOption];  // Inventory slot index
+        return MenuResult::SELECTED;
+    }
+    
+    return MenuResult::NONE;
+}
@@ -0,0 +1,81 @@
+#ifndef INVENTORY_MENU_H
+#define INVENTORY_MENU_H
+
+#include "MenuBase.h"
+#include "../item/inventory.h"
+
+class Player;
+struct CatalogEntry;
+
+// What one visible row currently shows. Rows are only redrawn when their
+// key changes, so moving the cursor costs two row redraws and scrolling
+// costs one per visible row - never a full screen clear.
+struct InventoryRowKey {
+    uint16_t itemID;    // ITEM_ID_NONE = blank row
+    uint16_t quantity;
+    uint8_t flags;      // ROW_* bits
+};
+
+// Scrollable list of the player's inventory with an item detail panel
+// (effect text, or gear stat and set changes from equipping the item).
+// The list is an Inventory::query result for the filter tab above it;
+// UP from the first row focuses the tab, where A cycles the filter.
+class InventoryMenu : public MenuBase {
+private:
+    // Layout
+    static const int VISIBLE_ROWS = 8;
+    static const int TAB_Y = 48;
+    static const int LIST_Y = 66;
+    static const int ROW_HEIGHT = 18;
+    static const int DETAIL_Y = LIST_Y + VISIBLE_ROWS * ROW_HEIGHT + 6;
+    static const int DETAIL_HEIGHT = 78;
+    
+    // Row flags
+    static const uint8_t ROW_SELECTED = 0x01;
+    static const uint8_t ROW_EQUIPPED = 0x02;
+    static const uint8_t ROW_MORE_ABOVE = 0x04;
+    static const uint8_t ROW_MORE_BELOW = 0x08;
+    static const uint8_t ROW_INVALID = 0x80;  // Forces a redraw
+    
+    Player* player;
+    
+    InventoryQuery view;                      // Slots shown, in list order
+    int filterIndex;                          // Into the filter tabs
+    bool tabFocused;
+    
+    int scrollTop;                            // First list row shown
+    InventoryRowKey rowCache[VISIBLE_ROWS];   // What each visible row shows now
+    bool frameDrawn;
+    bool statusDirty;
+    bool tabDirty;
+    bool detailDirty;
+    int lastDetailSelection;
+    
+    InventoryRowKey buildRowKey(int row) const;
+    void keepSelectionVisible();
+    void invalidateRows();
+    void runQuery();
+    
+    // Drawing
+    void drawFrame();
+    void drawStatusLine();
+    void drawFilterTab();
+    void drawRow(int row, const InventoryRowKey& key);
+    void drawDetail();
+    void drawComparison(const CatalogEntry& item, int y);
+    
+public:
+    InventoryMenu(Display* disp, Input* inp, Player* p);
+    
+    // Override base class methods
+    void render() override;
+    MenuResult handleInput() override;
+    void activate() override;
+    
+    // Call after the inventory changes (item used, equipped, ...)
+    void refresh();
+    
+    static uint16_t getRarityColor(int rarity);
+};
+
+#endif
@@ -7,8 +7,11 @@ CampfireRoomState::CampfireRoomState(Display* disp, Input* inp, Player* p, Enemy
     screenDrawn = false;
     lastSelectedOption = -1;
     showingInventory = false;
-    inventorySelectedItem = 0;
-    inventoryMaxItems = 0;
+    inventoryMenu = new InventoryMenu(display, input, player);
+}
+
+CampfireRoomState::~CampfireRoomState() {
+    delete inventoryMenu;
 }
 
 void CampfireRoomState::enterRoom() {
@@ -82,20 +85,6 @@ void CampfireRoomState::drawCampfireMenu() {
     lastSelectedOption = selectedOption;
 }
 
-void CampfireRoomState::drawInventoryScreen() {
-    display->clear();
-    
-    // Temporary message until we add inventory to Player
-    display->drawText("Inventory System", 20, 60, TFT_CYAN, 2);
-    display->drawText("Coming Soon!", 35, 100, TFT_YELLOW);
-    display->drawText("For now, you can:", 20, 130, TFT_WHITE);
-    display->drawText("- Rest at campfire", 20, 150, TFT_WHITE);
-    display->drawText("- Manage potions in", 20, 170, TFT_WHITE);
-    display->drawText("  combat menu", 20, 185, TFT_WHITE);
-    
-    display->drawText("B: Return to campfire", 5, 220, TFT_CYAN);
-}
-
 void CampfireRoomState::handleMenuInput() {
     // Navigation
     if (input->wasPressed(Button::UP)) {
@@ -124,22 +113,30 @@ void CampfireRoomState::handleMenuInput() {
                 openInventory();
                 break;
             case CampfireAction::LEAVE:
-                completeRoom();
+                completeRoom(false);  // Resting doesn't move the player on the map
                 break;
         }
     }
     
     // Quick exit
     if (input->wasPressed(Button::B)) {
-        completeRoom();
+        completeRoom(false);
     }
 }
 
 void CampfireRoomState::handleInventoryInput() {
-    // Simple return to menu for now
-    if (input->wasPressed(Button::B)) {
+    MenuResult result = inventoryMenu->handleInput();
+    
+    if (result == MenuResult::CANCELLED) {
         returnToMenu();
+        return;
+    }
+    if (result == MenuResult::SELECTED) {
+        useSelectedItem();
     }
+    
+    // Only rows that changed are redrawn
+    inventoryMenu->render();
 }
 
 void CampfireRoomState::performRest() {
@@ -175,17 +172,19 @@ void CampfireRoomState::performRest() {
 
 void CampfireRoomState::openInventory() {
     showingInventory = true;
-    inventorySelectedItem = 0;
-    drawInventoryScreen();
+    inventoryMenu->activate();
+    inventoryMenu->render();
 }
 
+// Drink a potion, or equip/unequip a piece of gear
 void CampfireRoomState::useSelectedItem() {
-    // Placeholder for when we add full inventory support
-    Serial.println("Item use not yet implemented - need to add inventory to Player class");
+    player->useItem(inventoryMenu->getSelectionResult());
+    inventoryMenu->refresh();
 }
 
 void CampfireRoomState::returnToMenu() {
     showingInventory = false;
+    inventoryMenu->deactivate();
     screenDrawn = false;
     drawCampfireMenu();
 }
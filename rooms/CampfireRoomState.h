@@ -2,6 +2,7 @@
 #define CAMPFIRE_ROOM_STATE_H
 
 #include "RoomState.h"
+#include "../menus/InventoryMenu.h"
 
 enum class CampfireAction {
     REST = 0,
@@ -19,15 +20,13 @@ private:
     
     // Inventory management
     bool showingInventory;
-    int inventorySelectedItem;
-    int inventoryMaxItems;
+    InventoryMenu* inventoryMenu;
     
     // Rest costs
     static const int REST_COST = 20;  // Gold cost to rest at campfire
     
     // Drawing methods
     void drawCampfireMenu();
-    void drawInventoryScreen();
     void drawRestConfirmation();
     
     // Input handling
@@ -38,12 +37,11 @@ private:
     void performRest();
     void openInventory();
     void useSelectedItem();
-    void equipSelectedItem();
     void returnToMenu();
     
 public:
     CampfireRoomState(Display* disp, Input* inp, Player* p, Enemy* e, DungeonManager* dm);
-    ~CampfireRoomState() = default;
+    ~CampfireRoomState();
     
     // RoomState interface implementation
     void enterRoom() override;
@@ -16,7 +16,7 @@ CombatRoomState::~CombatRoomState() {
 }
 
 void CombatRoomState::enterRoom() {
-    Serial.println("Starting combat in " + currentRoom->getRoomName());
+    Serial.println(String("Starting combat in ") + currentRoom->getRoomName());
     startCombat();
 }
 
@@ -51,13 +51,13 @@ void CombatRoomState::exitRoom() {
 }
 
 void CombatRoomState::startCombat() {
-    // Create enemy from room
+    // Spawn the room's enemy in place
     if (currentRoom) {
-        *currentEnemy = currentRoom->createEnemy();
-        Serial.println("Combat: Fighting " + currentEnemy->getName());
+        currentRoom->spawnEnemy(*currentEnemy);
+        Serial.println(String("Combat: Fighting ") + currentEnemy->getName());
     } else {
-        *currentEnemy = Enemy::createRandomEnemy();
-        Serial.println("Combat: Fighting random " + currentEnemy->getName());
+        currentEnemy->spawnRandom();
+        Serial.println(String("Combat: Fighting random ") + currentEnemy->getName());
     }
     
     // Start combat systems
@@ -90,6 +90,9 @@ void CombatRoomState::handleCombatInput() {
             case CombatAction::ITEM:
                 playerAction = ACTION_USE_ITEM;
                 break;
+            case CombatAction::AUTO:
+                autoResolveCombat();
+                return;
         }
         
         // Process combat turn
@@ -100,7 +103,11 @@ void CombatRoomState::handleCombatInput() {
         
         // Check if combat is over
         if (combatResult == RESULT_VICTORY) {
-            combatHUD->drawVictoryScreen();
+            int goldBefore = player->getGold();
+            int levelBefore = player->getLevel();
+            LootDrop loot = giveVictoryRewards();
+            combatHUD->drawVictoryScreen(loot, player->getGold() - goldBefore,
+                                         currentEnemy->getExperienceValue(), getLevelReached(levelBefore));
             combatActive = false;
             combatMenu->deactivate();
             showingResultScreen = true;  // Wait for player input
@@ -119,7 +126,7 @@ void CombatRoomState::handleCombatInput() {
             
             // Log what type of room we died in
             if (currentRoom) {
-                Serial.println("Died in: " + currentRoom->getRoomName());
+                Serial.println(String("Died in: ") + currentRoom->getRoomName());
                 if (currentRoom->getType() == ROOM_BOSS) {
                     Serial.println("Death was in boss room!");
                 }
@@ -133,3 +140,52 @@ void CombatRoomState::handleCombatInput() {
         }
     }
 }
+
+void CombatRoomState::autoResolveCombat() {
+    int goldBefore = player->getGold();
+    int levelBefore = player->getLevel();
+    
+    // Whole fight in one call - no per-turn HUD or menu redraws
+    AutoResolveSummary summary;
+    combatManager->autoResolve(summary);
+    
+    if (summary.result == RESULT_ONGOING) {
+        // Hit the turn cap - hand control back to the player
+        combatHUD->drawFullCombatScreen(player, currentEnemy, combatManager->getTurnCounter());
+        combatMenu->activate();
+        combatMenu->render();
+        return;
+    }
+    
+    LootDrop loot = {ITEM_ID_NONE, 0};
+    int xpGained = 0;
+    if (summary.result == RESULT_VICTORY) {
+        loot = giveVictoryRewards();
+        xpGained = currentEnemy->getExperienceValue();
+    }
+    combatHUD->drawAutoResolveSummary(summary, player->getGold() - goldBefore, loot,
+                                      xpGained, getLevelReached(levelBefore));
+    combatActive = false;
+    combatMenu->deactivate();
+    showingResultScreen = true;  // Same continue flow as a manual fight
+    
+    if (currentRoom && currentRoom->getType() == ROOM_BOSS) {
+        Serial.println(summary.result == RESULT_VICTORY ? "Boss defeated! Floor complete!" : "Death was in boss room!");
+    }
+}
+
+// Floor-scaled gold and XP from the enemy, then the room's loot roll
+LootDrop CombatRoomState::giveVictoryRewards() {
+    player->addGold(currentEnemy->getGoldValue());
+    player->addExperience(currentEnemy->getExperienceValue());
+    
+    if (!currentRoom) {
+        LootDrop none = {ITEM_ID_NONE, 0};
+        return none;
+    }
+    return currentRoom->giveCombatLoot(player);
+}
+
+int CombatRoomState::getLevelReached(int levelBefore) const {
+    return (player->getLevel() > levelBefore) ? player->getLevel() : 0;
+}
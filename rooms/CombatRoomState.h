@@ -29,6 +29,9 @@ public:
 private:
     void startCombat();
     void handleCombatInput();
+    void autoResolveCombat();
+    LootDrop giveVictoryRewards();  // Enemy gold and XP plus the room's enemy/boss drop
+    int getLevelReached(int levelBefore) const;  // New level, 0 if the fight didn't level up
 };
 
 #endif
@@ -21,7 +21,7 @@ void RoomState::enter() {
     }
     
     if (currentRoom) {
-        Serial.println("Entering: " + currentRoom->getRoomName());
+        Serial.println(String("Entering: ") + currentRoom->getRoomName());
         enterRoom(); // Call room-specific enter logic
         roomEntered = true;
     } else {
@@ -51,14 +51,17 @@ void RoomState::setCurrentRoom(Room* room) {
     currentRoom = room;
 }
 
-void RoomState::completeRoom() {
+void RoomState::completeRoom(bool advancesFloor) {
     roomCompleted = true;
-    if (currentRoom) {
+    if (advancesFloor && currentRoom) {
         currentRoom->setCompleted(true);
     }
-    if (dungeonManager) {
+    if (advancesFloor && dungeonManager) {
         dungeonManager->markRoomCompleted();
     }
+    if (player) {
+        player->tickEffects(); // Potion boosts last a number of rooms
+    }
     Serial.println("Room completed!");
 }
 
@@ -37,8 +37,9 @@ public:
     void setCurrentRoom(Room* room);
     Room* getCurrentRoom() const { return currentRoom; }
     
-    // Common room completion
-    void completeRoom();
+    // Common room completion. Pass false for visits that aren't a room on
+    // the floor (the campfire): effects still tick, progress doesn't move.
+    void completeRoom(bool advancesFloor = true);
     bool isRoomCompleted() const { return roomCompleted; }
     
 protected:
@@ -1 +1,296 @@
+#include "ShopRoomState.h"
+#include "../item/item_catalog.h"
 
+ShopRoomState::ShopRoomState(Display* disp, Input* inp, Player* p, Enemy* e, DungeonManager* dm) 
+    : RoomState(disp, inp, p, e, dm) {
+    selectedOption = 0;
+    maxOptions = 2;
+    screenDrawn = false;
+    lastSelectedOption = -1;
+    message = nullptr;
+    messageColor = TFT_WHITE;
+    selling = false;
+    sellView.count = 0;
+    sellScrollTop = 0;
+}
+
+void ShopRoomState::enterRoom() {
+    Serial.println("A shopkeeper waves you over...");
+    
+    // Stock was generated with the room; just count the rows
+    maxOptions = currentRoom->getShop().slotCount + 2;
+    selectedOption = 0;
+    selling = false;
+    message = nullptr;
+    screenDrawn = false;
+    drawShopScreen();
+}
+
+void ShopRoomState::handleRoomInteraction() {
+    // Navigation (an empty sell list has nothing to move over)
+    if (input->wasPressed(Button::UP) && maxOptions > 0) {
+        selectedOption--;
+        if (selectedOption < 0) {
+            selectedOption = maxOptions - 1;
+        }
+    }
+    
+    if (input->wasPressed(Button::DOWN) && maxOptions > 0) {
+        selectedOption++;
+        if (selectedOption >= maxOptions) {
+            selectedOption = 0;
+        }
+    }
+    
+    if (selling) {
+        if (input->wasPressed(Button::A) && maxOptions > 0) {
+            sellSelected();
+        }
+        
+        // Back to the stock list
+        if (input->wasPressed(Button::B)) {
+            closeSellList();
+        }
+        
+        if (lastSelectedOption != selectedOption || !screenDrawn) {
+            drawSellScreen();
+        }
+        return;
+    }
+    
+    // Selection
+    if (input->wasPressed(Button::A)) {
+        if (selectedOption == getLeaveOption()) {
+            completeRoom();
+            return;
+        } else if (selectedOption == getSellOption()) {
+            openSellList();
+            drawSellScreen();
+            return;
+        } else {
+            buySelected();
+        }
+    }
+    
+    // Quick exit
+    if (input->wasPressed(Button::B)) {
+        completeRoom();
+        return;
+    }
+    
+    // Redraw only when something changed
+    if (lastSelectedOption != selectedOption || !screenDrawn) {
+        drawShopScreen();
+    }
+}
+
+void ShopRoomState::exitRoom() {
+    Serial.println("The shopkeeper nods as you leave.");
+    message = nullptr;
+    selling = false;
+}
+
+int ShopRoomState::getSellOption() const {
+    return currentRoom->getShop().slotCount;
+}
+
+int ShopRoomState::getLeaveOption() const {
+    return currentRoom->getShop().slotCount + 1;
+}
+
+void ShopRoomState::buySelected() {
+    messageColor = TFT_RED;
+    switch (currentRoom->buyFromShop(player, selectedOption)) {
+        case PURCHASE_OK:
+            message = "Thank you!";
+            messageColor = TFT_GREEN;
+            break;
+        case PURCHASE_SOLD_OUT:
+            message = "Sold out!";
+            break;
+        case PURCHASE_NO_ROOM:
+            message = "Inventory full!";
+            break;
+        case PURCHASE_NO_GOLD:
+        default:
+            message = "Not enough gold!";
+            break;
+    }
+    screenDrawn = false;
+}
+
+void ShopRoomState::openSellList() {
+    selling = true;
+    selectedOption = 0;
+    sellScrollTop = 0;
+    message = nullptr;
+    refreshSellList();
+}
+
+void ShopRoomState::closeSellList() {
+    selling = false;
+    maxOptions = currentRoom->getShop().slotCount + 2;
+    selectedOption = getSellOption();
+    screenDrawn = false;
+}
+
+// Re-run the query after a sale (slots shift when a stack runs out)
+void ShopRoomState::refreshSellList() {
+    maxOptions = player->getInventory().query(FILTER_ALL, sellView);
+    if (selectedOption >= maxOptions) selectedOption = maxOptions - 1;
+    if (selectedOption < 0) selectedOption = 0;
+    screenDrawn = false;
+}
+
+void ShopRoomState::sellSelected() {
+    const InventorySlot& slot = player->getInventory().getItems()[sellView[selectedOption]];
+    messageColor = TFT_RED;
+    switch (currentRoom->sellToShop(player, slot.itemID)) {
+        case SALE_OK:
+            message = "Sold!";
+            messageColor = TFT_GREEN;
+            break;
+        case SALE_EQUIPPED:
+            message = "Unequip it first!";
+            break;
+        case SALE_INVALID:
+        default:
+            message = "Nothing to sell!";
+            break;
+    }
+    refreshSellList();
+}
+
+void ShopRoomState::drawStockRow(int index, int y, bool selected) {
+    const ShopSlot& slot = currentRoom->getShop().slots[index];
+    uint16_t nameColor = (slot.stock == 0) ? TFT_DARKGREY : TFT_WHITE;
+    
+    if (selected) {
+        display->fillRect(5, y - 3, 160, ROW_HEIGHT - 2, TFT_BLUE);
+        display->drawText(">", 10, y, TFT_YELLOW);
+    }
+    display->drawText(ItemCatalog::getName(slot.itemID), 20, y, nameColor);
+    
+    char text[24];
+    if (slot.stock == 0) {
+        snprintf(text, sizeof(text), "Sold out");
+    } else {
+        snprintf(text, sizeof(text), "%dg  (%d left)", slot.price, slot.stock);
+    }
+    display->drawText(text, 30, y + 11, (slot.price > player->getGold()) ? TFT_RED : TFT_YELLOW);
+}
+
+void ShopRoomState::drawShopScreen() {
+    display->clear();
+    const ShopStock& shop = currentRoom->getShop();
+    
+    // Title and gold
+    display->drawText("Shop", 60, 10, TFT_YELLOW, 2);
+    char text[32];
+    snprintf(text, sizeof(text), "Gold: %d  Potions: %d", player->getGold(), player->getHealthPotions());
+    display->drawText(text, 10, 35, TFT_YELLOW);
+    
+    // Stock
+    int y = LIST_Y;
+    for (int i = 0; i < shop.slotCount; i++) {
+        drawStockRow(i, y, i == selectedOption);
+        y += ROW_HEIGHT;
+    }
+    
+    // Sell and leave rows
+    const char* rows[2] = {"Sell items", "Leave"};
+    for (int i = 0; i < 2; i++) {
+        int option = getSellOption() + i;
+        if (option == selectedOption) {
+            display->fillRect(5, y - 3, 160, 16, TFT_BLUE);
+            display->drawText(">", 10, y, TFT_YELLOW);
+        }
+        display->drawText(rows[i], 20, y, TFT_WHITE);
+        y += 18;
+    }
+    
+    // Last transaction
+    if (message) {
+        display->drawText(message, 10, y + 8, messageColor);
+    }
+    
+    // Controls
+    display->drawText("UP/DOWN: Navigate", 10, 280, TFT_CYAN, 1);
+    display->drawText("A: Buy/Sell  B: Leave", 10, 295, TFT_CYAN, 1);
+    
+    screenDrawn = true;
+    lastSelectedOption = selectedOption;
+}
+
+void ShopRoomState::drawSellRow(int index, int y, bool selected) {
+    const Inventory& inventory = player->getInventory();
+    const InventorySlot& slot = inventory.getItems()[sellView[index]];
+    bool worn = inventory.isEquipped(slot.itemID);
+    
+    if (selected) {
+        display->fillRect(5, y - 3, 160, SELL_ROW_HEIGHT - 2, TFT_BLUE);
+        display->drawText(">", 10, y, TFT_YELLOW);
+    }
+    
+    char text[24];
+    if (slot.quantity > 1) {
+        snprintf(text, sizeof(text), "%s x%d", ItemCatalog::getName(slot.itemID), slot.quantity);
+    } else {
+        snprintf(text, sizeof(text), "%s", ItemCatalog::getName(slot.itemID));
+    }
+    display->drawText(text, 20, y, worn ? TFT_DARKGREY : TFT_WHITE);
+    
+    if (worn) {
+        display->drawText("E", 155, y, TFT_YELLOW);
+    } else {
+        snprintf(text, sizeof(text), "+%dg", ShopGen::getSellPrice(currentRoom->getShop(), slot.itemID));
+        display->drawText(text, 125, y, TFT_YELLOW);
+    }
+}
+
+void ShopRoomState::drawSellScreen() {
+    display->clear();
+    
+    // Title and gold
+    display->drawText("Sell", 60, 10, TFT_YELLOW, 2);
+    char text[32];
+    snprintf(text, sizeof(text), "Gold: %d", player->getGold());
+    display->drawText(text, 10, 35, TFT_YELLOW);
+    
+    // Keep the cursor on screen
+    if (selectedOption < sellScrollTop) {
+        sellScrollTop = selectedOption;
+    } else if (selectedOption >= sellScrollTop + SELL_VISIBLE_ROWS) {
+        sellScrollTop = selectedOption - SELL_VISIBLE_ROWS + 1;
+    }
+    if (sellScrollTop < 0) sellScrollTop = 0;
+    
+    int y = LIST_Y;
+    if (sellView.empty()) {
+        display->drawText("Nothing to sell", 20, y, TFT_DARKGREY);
+    }
+    for (int row = 0; row < SELL_VISIBLE_ROWS && sellScrollTop + row < sellView.size(); row++) {
+        drawSellRow(sellScrollTop + row, y, sellScrollTop + row == selectedOption);
+        y += SELL_ROW_HEIGHT;
+    }
+    
+    // Scroll hints
+    if (sellScrollTop > 0) {
+        display->drawText("^", 155, LIST_Y - 12, TFT_CYAN);
+    }
+    if (sellScrollTop + SELL_VISIBLE_ROWS < sellView.size()) {
+        display->drawText("v", 155, LIST_Y + SELL_VISIBLE_ROWS * SELL_ROW_HEIGHT, TFT_CYAN);
+    }
+    
+    // Last sale
+    if (message) {
+        display->drawText(message, 10, LIST_Y + SELL_VISIBLE_ROWS * SELL_ROW_HEIGHT + 14, messageColor);
+    }
+    
+    // Controls
+    display->drawText("UP/DOWN: Navigate", 10, 280, TFT_CYAN, 1);
+    display->drawText("A: Sell one  B: Back", 10, 295, TFT_CYAN, 1);
+    
+    screenDrawn = true;
+    lastSelectedOption = selectedOption;
+}
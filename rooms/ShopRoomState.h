@@ -1 +1,55 @@
+#ifndef SHOP_ROOM_STATE_H
+#define SHOP_ROOM_STATE_H
 
+#include "RoomState.h"
+
+class ShopRoomState : public RoomState {
+private:
+    // Menu state: stock rows, then "Sell items", then "Leave"
+    int selectedOption;
+    int maxOptions;
+    bool screenDrawn;
+    int lastSelectedOption;
+    
+    // Sell list: inventory slots in sort order, one unit sold per A press
+    bool selling;
+    InventoryQuery sellView;
+    int sellScrollTop;
+    
+    // Result of the last buy/sell (shown under the list)
+    const char* message;
+    uint16_t messageColor;
+    
+    // Layout
+    static const int LIST_Y = 55;
+    static const int ROW_HEIGHT = 28;
+    static const int SELL_ROW_HEIGHT = 18;
+    static const int SELL_VISIBLE_ROWS = 9;
+    
+    // Drawing methods
+    void drawShopScreen();
+    void drawStockRow(int index, int y, bool selected);
+    void drawSellScreen();
+    void drawSellRow(int index, int y, bool selected);
+    
+    // Actions
+    void buySelected();
+    void sellSelected();
+    void openSellList();
+    void closeSellList();
+    void refreshSellList();
+    
+    int getSellOption() const;
+    int getLeaveOption() const;
+    
+public:
+    ShopRoomState(Display* disp, Input* inp, Player* p, Enemy* e, DungeonManager* dm);
+    ~ShopRoomState() = default;
+    
+    // RoomState interface implementation
+    void enterRoom() override;
+    void handleRoomInteraction() override;
+    void exitRoom() override;
+};
+
+#endif
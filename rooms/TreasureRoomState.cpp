@@ -1 +1,68 @@
+#include "TreasureRoomState.h"
+#include "../item/item_catalog.h"
 
+TreasureRoomState::TreasureRoomState(Display* disp, Input* inp, Player* p, Enemy* e, DungeonManager* dm) 
+    : RoomState(disp, inp, p, e, dm) {
+    foundCount = 0;
+    goldFound = 0;
+}
+
+void TreasureRoomState::enterRoom() {
+    Serial.println("You pry open a dusty chest...");
+    int goldBefore = player->getGold();
+    foundCount = currentRoom->giveTreasure(player, found, MAX_TREASURE_DROPS);
+    goldFound = player->getGold() - goldBefore;  // 0 if the chest was already looted
+    drawTreasureScreen();
+}
+
+void TreasureRoomState::handleRoomInteraction() {
+    if (input->wasPressed(Button::UP) || 
+        input->wasPressed(Button::DOWN) ||
+        input->wasPressed(Button::A) || 
+        input->wasPressed(Button::B)) {
+        completeRoom();
+    }
+}
+
+void TreasureRoomState::exitRoom() {
+    Serial.println("You leave the empty chest behind...");
+    foundCount = 0;
+}
+
+void TreasureRoomState::drawTreasureScreen() {
+    display->clear();
+    
+    display->drawText("Treasure!", 35, 15, TFT_YELLOW, 2);
+    display->drawText("Something glints inside", 5, 40, TFT_ORANGE);
+    
+    // Loot list
+    char text[32];
+    int y = 70;
+    if (foundCount == 0) {
+        display->drawText("The chest is empty.", 10, y, TFT_WHITE);
+        y += 15;
+    }
+    for (int i = 0; i < foundCount; i++) {
+        if (found[i].quantity > 1) {
+            snprintf(text, sizeof(text), "%dx %s", found[i].quantity, ItemCatalog::getName(found[i].itemID));
+        } else {
+            snprintf(text, sizeof(text), "%s", ItemCatalog::getName(found[i].itemID));
+        }
+        display->drawText(text, 10, y, TFT_GREEN);
+        y += 15;
+    }
+    
+    if (goldFound > 0) {
+        snprintf(text, sizeof(text), "%d gold", goldFound);
+        display->drawText(text, 10, y, TFT_YELLOW);
+    }
+    
+    // Player status
+    snprintf(text, sizeof(text), "HP: %d/%d  Gold: %d", player->getCurrentHP(), player->getMaxHP(), player->getGold());
+    display->drawText(text, 10, 150, TFT_WHITE);
+    snprintf(text, sizeof(text), "Potions: %d", player->getHealthPotions());
+    display->drawText(text, 10, 165, TFT_WHITE);
+    
+    display->drawText("Press any button", 10, 200, TFT_CYAN);
+    display->drawText("to continue", 35, 215, TFT_CYAN);
+}
@@ -1 +1,26 @@
+#ifndef TREASURE_ROOM_STATE_H
+#define TREASURE_ROOM_STATE_H
 
+#include "RoomState.h"
+#include "../utils/constants.h"
+
+class TreasureRoomState : public RoomState {
+private:
+    // What the chest gave this visit
+    LootDrop found[MAX_TREASURE_DROPS];
+    int foundCount;
+    int goldFound;
+    
+    void drawTreasureScreen();
+    
+public:
+    TreasureRoomState(Display* disp, Input* inp, Player* p, Enemy* e, DungeonManager* dm);
+    ~TreasureRoomState() = default;
+    
+    // RoomState interface implementation
+    void enterRoom() override;
+    void handleRoomInteraction() override;
+    void exitRoom() override;
+};
+
+#endif
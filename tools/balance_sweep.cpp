@@ -0,0 +1,170 @@
+// Host tool: sweeps every enemy type against a grid of player builds,
+// running many seeded fights per cell through the lane-parallel combat
+// kernel, checks that it matches the scalar CombatRules engine, and reports
+// the weakest build that still wins 90% against each enemy.
+//
+// Build (from the repo root):
+//   g++ -O3 -march=native -std=c++11 -I. tools/balance_sweep.cpp combat/combat_lanes.cpp combat/combat_rules.cpp utils/rng.cpp -o balance_sweep
+// Usage:
+//   ./balance_sweep [fights per cell]
+
+#ifndef ARDUINO
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#include <vector>
+
+#include "combat/combat_lanes.h"
+#include "combat/combat_rules.h"
+#include "entities/enemy_archetypes.h"
+#include "utils/constants.h"
+#include "utils/rng.h"
+
+// Enemy stat blocks (floor 1 rows of ENEMY_ARCHETYPES)
+struct EnemySpec {
+    const char* name;
+    FighterStats stats;
+    AIType ai;
+};
+
+#define ENEMY_SPEC(label, id) {label, {ENEMY_ARCHETYPES[id].hp, ENEMY_ARCHETYPES[id].attack, \
+    ENEMY_ARCHETYPES[id].defense, ENEMY_ARCHETYPES[id].speed}, (AIType)ENEMY_ARCHETYPES[id].aiType}
+
+static const EnemySpec ENEMIES[] = {
+    ENEMY_SPEC("Goblin",   ENEMY_ID_GOBLIN),
+    ENEMY_SPEC("Skeleton", ENEMY_ID_SKELETON),
+    ENEMY_SPEC("Orc",      ENEMY_ID_ORC),
+};
+
+// Player build grid
+static const int HP_VALUES[] = {40, 50, 60, 75, 90};
+static const int ATK_VALUES[] = {10, 12, 15, 18, 22};
+static const int DEF_VALUES[] = {5, 8, 11, 14};
+static const int SPD_VALUES[] = {5, 10, 15};
+static const int POTION_VALUES[] = {0, 3, 6};
+
+#define COUNT_OF(a) ((int)(sizeof(a) / sizeof((a)[0])))
+
+// Grid position of a build, in fight order (potions vary fastest)
+struct BuildIndex {
+    int hp, atk, def, spd, potions;
+    
+    int steps() const { return hp + atk + def + spd + potions; }
+};
+
+static BuildIndex decodeBuild(int build) {
+    BuildIndex index;
+    index.potions = build % COUNT_OF(POTION_VALUES); build /= COUNT_OF(POTION_VALUES);
+    index.spd = build % COUNT_OF(SPD_VALUES);         build /= COUNT_OF(SPD_VALUES);
+    index.def = build % COUNT_OF(DEF_VALUES);         build /= COUNT_OF(DEF_VALUES);
+    index.atk = build % COUNT_OF(ATK_VALUES);         build /= COUNT_OF(ATK_VALUES);
+    index.hp = build;
+    return index;
+}
+
+int main(int argc, char** argv) {
+    int fightsPerCell = (argc > 1) ? atoi(argv[1]) : 256;
+    if (fightsPerCell < 1) fightsPerCell = 1;
+    
+    int builds = COUNT_OF(HP_VALUES) * COUNT_OF(ATK_VALUES) * COUNT_OF(DEF_VALUES) *
+                 COUNT_OF(SPD_VALUES) * COUNT_OF(POTION_VALUES);
+    size_t total = (size_t)builds * COUNT_OF(ENEMIES) * fightsPerCell;
+    
+    printf("Grid: %d enemies x %d builds x %d fights = %zu fights (%s kernel)\n",
+           COUNT_OF(ENEMIES), builds, fightsPerCell, total,
+           CombatLanes::isVectorized() ? "vector" : "scalar");
+    
+    // Build every fight up front
+    std::vector<CombatSnapshot> lanes(total);
+    size_t n = 0;
+    uint32_t seed = 1;
+    for (const EnemySpec& e : ENEMIES)
+        for (int hp : HP_VALUES)
+            for (int atk : ATK_VALUES)
+                for (int def : DEF_VALUES)
+                    for (int spd : SPD_VALUES)
+                        for (int potions : POTION_VALUES) {
+                            FighterStats hero = {hp, atk, def, spd};
+                            for (int i = 0; i < fightsPerCell; i++)
+                                CombatRules::beginFight(lanes[n++], hero, e.stats, e.ai, potions, seed++);
+                        }
+    std::vector<CombatSnapshot> scalar = lanes;
+    
+    LanePolicy policy = {LANE_POTION_THRESHOLD_HP};
+    
+    auto t0 = std::chrono::steady_clock::now();
+    CombatLanes::runBatch(lanes.data(), (int)total, policy);
+    auto t1 = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < total; i++) {
+        CombatLanes::runScalar(scalar[i], policy);
+    }
+    auto t2 = std::chrono::steady_clock::now();
+    
+    double laneSeconds = std::chrono::duration<double>(t1 - t0).count();
+    double scalarSeconds = std::chrono::duration<double>(t2 - t1).count();
+    
+    // Bit-for-bit check against the scalar engine
+    size_t mismatches = 0;
+    for (size_t i = 0; i < total; i++) {
+        if (memcmp(&lanes[i], &scalar[i], sizeof(CombatSnapshot)) != 0) {
+            if (mismatches < 5) {
+                printf("MISMATCH fight %zu: hp %d/%d vs %d/%d turn %d vs %d\n", i,
+                       lanes[i].player.currentHP, lanes[i].enemy.currentHP,
+                       scalar[i].player.currentHP, scalar[i].enemy.currentHP,
+                       lanes[i].turnCounter, scalar[i].turnCounter);
+            }
+            mismatches++;
+        }
+    }
+    
+    printf("Lanes:  %.3f s (%.1f M fights/s)\n", laneSeconds, total / laneSeconds / 1e6);
+    printf("Scalar: %.3f s (%.1f M fights/s)\n", scalarSeconds, total / scalarSeconds / 1e6);
+    printf("Mismatches vs scalar: %zu\n\n", mismatches);
+    
+    // Win rate per enemy, and the weakest build that still wins 90%.
+    // A build's strength is the sum of its steps up each grid axis (potions
+    // count as an axis), so the weakest winner is the smallest step total;
+    // ties go to the lower win rate, the build closest to the line.
+    size_t perEnemy = (size_t)builds * fightsPerCell;
+    for (int e = 0; e < COUNT_OF(ENEMIES); e++) {
+        size_t wins = 0, turns = 0;
+        for (size_t i = e * perEnemy; i < (e + 1) * perEnemy; i++) {
+            if (lanes[i].combatState == COMBAT_PLAYER_WIN) wins++;
+            turns += lanes[i].turnCounter - 1;
+        }
+        printf("%-9s win %5.1f%%  avg turns %.1f\n", ENEMIES[e].name,
+               100.0 * wins / perEnemy, (double)turns / perEnemy);
+        
+        int weakest = -1, weakestSteps = 0, weakestWins = 0;
+        for (int b = 0; b < builds; b++) {
+            const CombatSnapshot* cell = &lanes[e * perEnemy + (size_t)b * fightsPerCell];
+            int cellWins = 0;
+            for (int i = 0; i < fightsPerCell; i++) {
+                if (cell[i].combatState == COMBAT_PLAYER_WIN) cellWins++;
+            }
+            if (cellWins * 10 < fightsPerCell * 9) continue;
+            
+            int steps = decodeBuild(b).steps();
+            if (weakest < 0 || steps < weakestSteps || (steps == weakestSteps && cellWins < weakestWins)) {
+                weakest = b;
+                weakestSteps = steps;
+                weakestWins = cellWins;
+            }
+        }
+        
+        if (weakest < 0) {
+            printf("          no build wins 90%%\n");
+            continue;
+        }
+        BuildIndex build = decodeBuild(weakest);
+        printf("          weakest 90%% build: HP %d ATK %d DEF %d SPD %d potions %d (win %.1f%%)\n",
+               HP_VALUES[build.hp], ATK_VALUES[build.atk], DEF_VALUES[build.def], SPD_VALUES[build.spd],
+               POTION_VALUES[build.potions], 100.0 * weakestWins / fightsPerCell);
+    }
+    
+    return mismatches == 0 ? 0 : 1;
+}
+
+#endif
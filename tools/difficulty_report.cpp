@@ -0,0 +1,106 @@
+// Host tool: prints the per-floor enemy stat tables from EnemyCurves and
+// simulates fights on every floor to show how the curves play out against
+// a fresh hero and against one that picked up gear along the way.
+//
+// Build (from the repo root):
+//   g++ -O2 -std=c++11 -I. tools/difficulty_report.cpp entities/enemy_curves.cpp combat/combat_lanes.cpp combat/combat_rules.cpp utils/name_tables.cpp utils/rng.cpp -o difficulty_report
+// Usage:
+//   ./difficulty_report [fights per cell]
+
+#ifndef ARDUINO
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "entities/enemy_curves.h"
+#include "entities/enemy_archetypes.h"
+#include "combat/combat_lanes.h"
+#include "combat/combat_rules.h"
+#include "utils/constants.h"
+#include "utils/rng.h"
+
+// Rough gear a hero has collected by a given floor (loot and shop upgrades)
+static const int GEAR_HP_PER_FLOOR = 6;
+static const int GEAR_ATK_PER_FLOOR = 2;
+static const int GEAR_DEF_PER_FLOOR = 2;
+
+static FighterStats heroForFloor(bool geared, int floorNumber) {
+    int floors = floorNumber - 1;
+    FighterStats hero = {PLAYER_START_HP, PLAYER_START_ATK, PLAYER_START_DEF, PLAYER_START_SPD};
+    if (geared) {
+        hero.hp += GEAR_HP_PER_FLOOR * floors;
+        hero.attack += GEAR_ATK_PER_FLOOR * floors;
+        hero.defense += GEAR_DEF_PER_FLOOR * floors;
+    }
+    return hero;
+}
+
+int main(int argc, char** argv) {
+    int fights = (argc > 1) ? atoi(argv[1]) : 2000;
+    if (fights < 1) fights = 1;
+    
+    // Stat tables
+    printf("Enemy stats per floor (HP/ATK/DEF/SPD, XP, gold)\n");
+    printf("floor");
+    for (int id = 1; id < ENEMY_ID_COUNT; id++) printf("  %-27s", NameTables::getEnemyName(id));
+    printf("\n");
+    for (int floor = 1; floor <= DIFFICULTY_FLOORS; floor++) {
+        printf("%5d", floor);
+        for (int id = 1; id < ENEMY_ID_COUNT; id++) {
+            const EnemyStatBlock& s = EnemyCurves::getStats(id, floor);
+            char cell[48];
+            snprintf(cell, sizeof(cell), "%d/%d/%d/%d %dxp %dg", s.hp, s.attack, s.defense, s.speed,
+                     s.experience, s.gold);
+            printf("  %-27s", cell);
+        }
+        printf("\n");
+    }
+    
+    // Simulated fights
+    LanePolicy policy = {LANE_POTION_THRESHOLD_HP};
+    std::vector<CombatSnapshot> batch(fights);
+    uint32_t seed = 1;
+    
+    for (int geared = 0; geared < 2; geared++) {
+        printf("\nWin rate / avg HP lost / avg potions used, %s hero, %d fights per cell\n",
+               geared ? "geared" : "fresh", fights);
+        printf("floor");
+        for (int id = 1; id < ENEMY_ID_COUNT; id++) printf("  %-22s", NameTables::getEnemyName(id));
+        printf("\n");
+        
+        for (int floor = 1; floor <= DIFFICULTY_FLOORS; floor++) {
+            FighterStats hero = heroForFloor(geared != 0, floor);
+            printf("%5d", floor);
+            
+            for (int id = 1; id < ENEMY_ID_COUNT; id++) {
+                const EnemyStatBlock& stats = EnemyCurves::getStats(id, floor);
+                FighterStats enemy = {stats.hp, stats.attack, stats.defense, stats.speed};
+                AIType ai = (AIType)ENEMY_ARCHETYPES[id].aiType;
+                for (int i = 0; i < fights; i++) {
+                    CombatRules::beginFight(batch[i], hero, enemy, ai, STARTING_POTIONS, seed++);
+                }
+                CombatLanes::runBatch(batch.data(), fights, policy);
+                
+                long wins = 0, hpLost = 0, potionsUsed = 0;
+                for (int i = 0; i < fights; i++) {
+                    const CombatSnapshot& f = batch[i];
+                    if (f.combatState == COMBAT_PLAYER_WIN) {
+                        wins++;
+                        hpLost += hero.hp - f.player.currentHP;
+                    }
+                    potionsUsed += STARTING_POTIONS - f.healthPotions;
+                }
+                char cell[32];
+                snprintf(cell, sizeof(cell), "%5.1f%% %5.1f %4.2f", 100.0 * wins / fights,
+                         wins ? (double)hpLost / wins : 0.0, (double)potionsUsed / fights);
+                printf("  %-22s", cell);
+            }
+            printf("\n");
+        }
+    }
+    
+    return 0;
+}
+
+#endif
@@ -0,0 +1,189 @@
+// Host tool: generates floors from random seeds through FloorGraphGen (the
+// layout core Floor::generateFloor runs), measures throughput and heap use,
+// and checks the generation invariants on every floor.
+//
+// Build (from the repo root):
+//   g++ -O2 -std=c++11 -I. tools/dungeon_bench.cpp dungeon/floor_graph.cpp entities/enemy_archetypes.cpp utils/rng.cpp -o dungeon_bench
+// Usage:
+//   ./dungeon_bench [floors] [run seed]
+
+#ifndef ARDUINO
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <new>
+#include <chrono>
+
+#include "dungeon/floor_graph.h"
+#include "utils/rng.h"
+
+// Count every heap allocation made while generating
+static size_t allocationCount = 0;
+static size_t allocationBytes = 0;
+
+void* operator new(size_t size) {
+    allocationCount++;
+    allocationBytes += size;
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+// Expected room type split (same as FloorGraphGen::rollNodeType)
+static const double EXPECTED_PERCENT[3] = {60.0, 25.0, 15.0};
+static const char* TYPE_NAMES[3] = {"enemy", "treasure", "shop"};
+static const double PERCENT_TOLERANCE = 0.5;
+
+// Floors cycle through these depths so treasure bounds see many floor numbers
+static const int MAX_FLOOR_NUMBER = 100;
+
+struct Failures {
+    size_t bossUnreachable;
+    size_t orphanRoom;
+    size_t badEdge;
+    size_t badEnemy;
+    size_t badTreasure;
+    size_t nonDeterministic;
+};
+
+// Forward reachability from the entrance; the boss and every room must be hit
+static void checkReachability(const FloorGraph& graph, Failures& fail) {
+    bool reached[FLOOR_GRAPH_MAX_NODES] = {false};
+    for (int i = 0; i < graph.entryCount; i++) {
+        reached[graph.entry[i]] = true;
+    }
+
+    // Rooms are in layer order, so one forward pass is enough
+    for (int node = 1; node < graph.nodeCount; node++) {
+        if (!reached[node]) continue;
+        for (int e = 0; e < FloorGraphGen::getOutDegree(graph, node); e++) {
+            reached[FloorGraphGen::getSuccessor(graph, node, e)] = true;
+        }
+    }
+
+    if (!reached[FLOOR_BOSS_NODE]) fail.bossUnreachable++;
+    for (int node = 1; node < graph.nodeCount; node++) {
+        if (!reached[node]) {
+            fail.orphanRoom++;
+            break;
+        }
+    }
+}
+
+static void checkFloor(const FloorGraph& graph, int floorNumber, Failures& fail, size_t typeCounts[3]) {
+    checkReachability(graph, fail);
+
+    for (int node = 1; node < graph.nodeCount; node++) {
+        uint32_t packed = graph.nodes[node];
+        int type = FloorGraphGen::getType(packed);
+
+        // Every room leads somewhere, at most two doors, always forward
+        int degree = FloorGraphGen::getOutDegree(graph, node);
+        if (degree < 1 || degree > FLOOR_NODE_LINKS) fail.badEdge++;
+        for (int e = 0; e < degree; e++) {
+            int next = FloorGraphGen::getSuccessor(graph, node, e);
+            if (next != FLOOR_BOSS_NODE && next <= node) fail.badEdge++;
+        }
+
+        if (type == NODE_BOSS) {
+            fail.badEdge++;
+            continue;
+        }
+        typeCounts[type]++;
+
+        if (type == NODE_ENEMY) {
+            int enemyID = FloorGraphGen::getEnemyID(packed);
+            if (enemyID <= ENEMY_ID_UNKNOWN || enemyID >= ENEMY_ID_COUNT) fail.badEnemy++;
+        } else if (type == NODE_TREASURE) {
+            int treasureType = FloorGraphGen::getTreasureType(packed);
+            int value = FloorGraphGen::getTreasureValue(packed);
+            if (treasureType < 1 || treasureType > 3) fail.badTreasure++;
+            if (value < floorNumber + 1 || value > floorNumber + 3) fail.badTreasure++;
+        }
+    }
+
+    // Route DP must agree that the boss is reachable from the entrance
+    FloorRoutes routes;
+    FloorGraphGen::analyzeRoutes(graph, routes);
+    for (int i = 0; i < graph.entryCount; i++) {
+        if (routes.minFights[graph.entry[i]] == 0xFF) fail.bossUnreachable++;
+    }
+}
+
+int main(int argc, char** argv) {
+    long floors = (argc > 1) ? atol(argv[1]) : 1000000;
+    uint32_t runSeed = (argc > 2) ? (uint32_t)strtoul(argv[2], nullptr, 0) : 12345;
+    if (floors < 1) floors = 1;
+
+    printf("Generating %ld floors (run seed %u)\n", floors, runSeed);
+
+    FloorGraph graph;
+    Rng seeds(runSeed);
+
+    // Throughput: generation only
+    size_t allocsBefore = allocationCount;
+    size_t bytesBefore = allocationBytes;
+    uint32_t checksum = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (long i = 0; i < floors; i++) {
+        int floorNumber = 1 + (int)(i % MAX_FLOOR_NUMBER);
+        FloorGraphGen::generate(graph, floorNumber, seeds.next());
+        checksum ^= graph.nodes[1];
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    size_t allocs = allocationCount - allocsBefore;
+    size_t bytes = allocationBytes - bytesBefore;
+
+    double seconds = std::chrono::duration<double>(t1 - t0).count();
+    printf("Generation: %.3f s, %.2f M floors/s (checksum %08x)\n", seconds, floors / seconds / 1e6, checksum);
+    printf("Heap: %zu allocations, %.2f bytes per floor\n", allocs, (double)bytes / floors);
+    printf("Floor size: %zu bytes\n\n", sizeof(FloorGraph));
+
+    // Invariants (separate pass so checks don't skew the timing)
+    Failures fail = {0, 0, 0, 0, 0, 0};
+    size_t typeCounts[3] = {0, 0, 0};
+    seeds.seed(runSeed);
+    for (long i = 0; i < floors; i++) {
+        int floorNumber = 1 + (int)(i % MAX_FLOOR_NUMBER);
+        uint32_t seed = seeds.next();
+        FloorGraphGen::generate(graph, floorNumber, seed);
+        checkFloor(graph, floorNumber, fail, typeCounts);
+
+        // Same seed, same floor
+        if ((i & 1023) == 0) {
+            FloorGraph again;
+            FloorGraphGen::generate(again, floorNumber, seed);
+            if (FloorGraphGen::hash(again) != FloorGraphGen::hash(graph)) fail.nonDeterministic++;
+        }
+    }
+
+    size_t rooms = typeCounts[0] + typeCounts[1] + typeCounts[2];
+    bool distributionOK = true;
+    printf("Room types over %zu rooms:\n", rooms);
+    for (int t = 0; t < 3; t++) {
+        double percent = 100.0 * typeCounts[t] / rooms;
+        bool ok = (percent > EXPECTED_PERCENT[t] - PERCENT_TOLERANCE) &&
+                  (percent < EXPECTED_PERCENT[t] + PERCENT_TOLERANCE);
+        distributionOK = distributionOK && ok;
+        printf("  %-8s %6.2f%% (expected %.0f%%) %s\n", TYPE_NAMES[t], percent, EXPECTED_PERCENT[t], ok ? "ok" : "FAIL");
+    }
+
+    printf("\nBoss unreachable:      %zu\n", fail.bossUnreachable);
+    printf("Orphan rooms:          %zu\n", fail.orphanRoom);
+    printf("Bad edges:             %zu\n", fail.badEdge);
+    printf("Bad enemy IDs:         %zu\n", fail.badEnemy);
+    printf("Treasure out of range: %zu\n", fail.badTreasure);
+    printf("Non-deterministic:     %zu\n", fail.nonDeterministic);
+
+    size_t failures = fail.bossUnreachable + fail.orphanRoom + fail.badEdge + fail.badEnemy +
+                      fail.badTreasure + fail.nonDeterministic;
+    bool passed = (failures == 0) && distributionOK && (allocs == 0);
+    printf("\n%s\n", passed ? "PASS" : "FAIL");
+    return passed ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,192 @@
+// Host tool: uses consumables through the catalog's effect bytecode
+// (ItemEffects::run) and through a virtual-subclass replica of the old
+// per-item use() overrides, times both, checks that they leave the target
+// in the same state, and checks the interpreter never allocates.
+//
+// Build (from the repo root):
+//   g++ -O2 -std=c++11 -I. tools/effect_bench.cpp item/item_catalog.cpp item/item_effects.cpp utils/rng.cpp -o effect_bench
+// Usage:
+//   ./effect_bench [uses] [seed]
+
+#ifndef ARDUINO
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <new>
+#include <chrono>
+
+#include "item/item_catalog.h"
+#include "item/item_effects.h"
+#include "utils/constants.h"
+#include "utils/rng.h"
+
+// Count every heap allocation made while timing
+static size_t allocationCount = 0;
+
+void* operator new(size_t size) {
+    allocationCount++;
+    void* p = malloc(size ? size : 1);
+    if (!p) throw std::bad_alloc();
+    return p;
+}
+
+void operator delete(void* p) noexcept {
+    free(p);
+}
+
+// Stand-in for the player (and an enemy), same interface the game's target has
+struct BenchTarget {
+    int hp;
+    int maxHP;
+    int bonus[4];
+    int effectCount;
+    int enemyHP;
+    
+    int getCurrentHP() const { return hp; }
+    int getMaxHP() const { return maxHP; }
+    void heal(int amount) { hp += amount; if (hp > maxHP) hp = maxHP; }
+    void addEffect(int h, int a, int d, int s, int rooms) {
+        bonus[0] += h; bonus[1] += a; bonus[2] += d; bonus[3] += s;
+        effectCount += rooms;
+    }
+    void cureEffects() {}
+    bool hasEnemy() const { return enemyHP > 0; }
+    void damageEnemy(int amount) { enemyHP -= amount; }
+    
+    uint32_t checksum() const {
+        return (uint32_t)hp * 31u + (uint32_t)bonus[1] * 7u + (uint32_t)bonus[2] * 13u +
+               (uint32_t)bonus[3] * 17u + (uint32_t)effectCount;
+    }
+};
+
+// The old shape: one class per item, each use() hardcoding its effect
+class BenchItem {
+public:
+    virtual ~BenchItem() {}
+    virtual bool use(BenchTarget& t) const = 0;
+};
+
+class HealthPotion : public BenchItem {
+public:
+    bool use(BenchTarget& t) const override {
+        if (t.hp >= t.maxHP) return false;
+        t.heal(POTION_HEAL_AMOUNT);
+        return true;
+    }
+};
+
+class GreaterHealthPotion : public BenchItem {
+public:
+    bool use(BenchTarget& t) const override {
+        if (t.hp >= t.maxHP) return false;
+        t.heal(60);
+        return true;
+    }
+};
+
+class StrengthPotion : public BenchItem {
+public:
+    bool use(BenchTarget& t) const override { t.addEffect(0, 5, 0, 0, 10); return true; }
+};
+
+class DefensePotion : public BenchItem {
+public:
+    bool use(BenchTarget& t) const override { t.addEffect(0, 0, 4, 0, 10); return true; }
+};
+
+class SpeedPotion : public BenchItem {
+public:
+    bool use(BenchTarget& t) const override { t.addEffect(0, 0, 0, 6, 10); return true; }
+};
+
+static const int ITEM_KINDS = 5;
+static const uint16_t ITEM_IDS[ITEM_KINDS] = {
+    ITEM_ID_HEALTH_POTION, ITEM_ID_GREATER_HEALTH_POTION, ITEM_ID_STRENGTH_POTION,
+    ITEM_ID_DEFENSE_POTION, ITEM_ID_SPEED_POTION
+};
+
+static BenchTarget freshTarget() {
+    BenchTarget t = {100, 100, {0, 0, 0, 0}, 0, 1000};
+    return t;
+}
+
+int main(int argc, char** argv) {
+    long uses = (argc > 1) ? atol(argv[1]) : 20000000;
+    uint32_t seed = (argc > 2) ? (uint32_t)strtoul(argv[2], nullptr, 0) : 12345;
+    if (uses < 1) uses = 1;
+    
+    // Same random item sequence for both paths; HP drops before each use so heals apply
+    uint8_t* sequence = (uint8_t*)malloc(uses);
+    uint8_t* damage = (uint8_t*)malloc(uses);
+    Rng rng(seed);
+    for (long i = 0; i < uses; i++) {
+        sequence[i] = (uint8_t)rng.nextBounded(ITEM_KINDS);
+        damage[i] = (uint8_t)rng.nextBounded(80);
+    }
+    
+    const uint8_t* programs[ITEM_KINDS];
+    int bytecodeBytes = 0;
+    printf("Effect programs:\n");
+    for (int k = 0; k < ITEM_KINDS; k++) {
+        const CatalogEntry* item = ItemCatalog::find(ITEM_IDS[k]);
+        char text[48];
+        programs[k] = item->effect;
+        bytecodeBytes += ItemEffects::getLength(item->effect);
+        ItemEffects::describe(item->effect, text, sizeof(text));
+        printf("  %-22s %2d bytes  %s\n", item->name, ItemEffects::getLength(item->effect), text);
+    }
+    printf("Total bytecode: %d bytes\n\n", bytecodeBytes);
+    
+    BenchItem* objects[ITEM_KINDS] = {
+        new HealthPotion(), new GreaterHealthPotion(), new StrengthPotion(), new DefensePotion(), new SpeedPotion()
+    };
+    
+    // Virtual dispatch
+    BenchTarget virtualTarget = freshTarget();
+    long virtualApplied = 0;
+    auto t0 = std::chrono::steady_clock::now();
+    for (long i = 0; i < uses; i++) {
+        virtualTarget.hp -= damage[i];
+        if (virtualTarget.hp < 1) virtualTarget.hp = 1;
+        virtualApplied += objects[sequence[i]]->use(virtualTarget);
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    
+    // Bytecode interpreter
+    BenchTarget bytecodeTarget = freshTarget();
+    long bytecodeApplied = 0;
+    size_t allocsBefore = allocationCount;
+    auto t2 = std::chrono::steady_clock::now();
+    for (long i = 0; i < uses; i++) {
+        bytecodeTarget.hp -= damage[i];
+        if (bytecodeTarget.hp < 1) bytecodeTarget.hp = 1;
+        bytecodeApplied += (ItemEffects::run(programs[sequence[i]], bytecodeTarget) == EFFECT_APPLIED);
+    }
+    auto t3 = std::chrono::steady_clock::now();
+    size_t allocs = allocationCount - allocsBefore;
+    
+    double virtualSeconds = std::chrono::duration<double>(t1 - t0).count();
+    double bytecodeSeconds = std::chrono::duration<double>(t3 - t2).count();
+    printf("Uses: %ld (seed %u)\n", uses, seed);
+    printf("Virtual:  %.3f s, %.2f ns/use, %ld applied (checksum %08x)\n",
+           virtualSeconds, virtualSeconds * 1e9 / uses, virtualApplied, virtualTarget.checksum());
+    printf("Bytecode: %.3f s, %.2f ns/use, %ld applied (checksum %08x)\n",
+           bytecodeSeconds, bytecodeSeconds * 1e9 / uses, bytecodeApplied, bytecodeTarget.checksum());
+    printf("Bytecode / virtual time: %.2fx\n", bytecodeSeconds / virtualSeconds);
+    printf("Interpreter heap allocations: %zu\n", allocs);
+    
+    bool same = (virtualApplied == bytecodeApplied) && (virtualTarget.checksum() == bytecodeTarget.checksum());
+    printf("Same results: %s\n", same ? "yes" : "NO");
+    
+    for (int k = 0; k < ITEM_KINDS; k++) {
+        delete objects[k];
+    }
+    free(sequence);
+    free(damage);
+    
+    bool passed = same && (allocs == 0);
+    printf("\n%s\n", passed ? "PASS" : "FAIL");
+    return passed ? 0 : 1;
+}
+
+#endif
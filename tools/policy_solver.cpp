@@ -0,0 +1,256 @@
+// Host tool: solves optimal combat play with value iteration and writes
+// compressed policy/value tables (see combat/combat_policy.h).
+//
+// Build (from the repo root):
+//   g++ -O2 -std=c++11 -I. tools/policy_solver.cpp combat/combat_rules.cpp combat/combat_policy.cpp utils/rng.cpp -o policy_solver
+// Usage:
+//   ./policy_solver [hp atk def spd potions] [--emit combat/generated]
+// With --emit, one policy_<enemy>.h per enemy type is written for the
+// given player build (defaults to the starting stats).
+
+#ifndef ARDUINO
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <vector>
+
+#include "combat/combat_rules.h"
+#include "combat/combat_policy.h"
+#include "entities/enemy_archetypes.h"
+#include "utils/constants.h"
+
+// Enemy stat blocks (floor 1 rows of ENEMY_ARCHETYPES)
+struct EnemySpec {
+    const char* name;
+    int hp, atk, def, spd;
+    AIType ai;
+};
+
+#define ENEMY_SPEC(label, id) {label, ENEMY_ARCHETYPES[id].hp, ENEMY_ARCHETYPES[id].attack, \
+    ENEMY_ARCHETYPES[id].defense, ENEMY_ARCHETYPES[id].speed, (AIType)ENEMY_ARCHETYPES[id].aiType}
+
+static const EnemySpec ENEMIES[] = {
+    ENEMY_SPEC("goblin",   ENEMY_ID_GOBLIN),
+    ENEMY_SPEC("skeleton", ENEMY_ID_SKELETON),
+    ENEMY_SPEC("orc",      ENEMY_ID_ORC),
+};
+
+struct PlayerSpec {
+    int hp, atk, def, spd, potions;
+};
+
+static const uint32_t STATE_WIN = 0xFFFFFFFE;
+static const uint32_t STATE_LOSE = 0xFFFFFFFF;
+
+struct Solver {
+    CombatPolicyTable table;
+    uint32_t stateCount;
+    std::vector<double> values;
+    std::vector<uint32_t> successors;   // [state][action][enemyAction]
+    std::vector<uint8_t> entries;
+    double attackChance;
+    int iterations;
+    
+    void decode(uint32_t index, CombatSnapshot& s) const {
+        int enemyDefending = index & 1; index >>= 1;
+        int playerDefending = index & 1; index >>= 1;
+        int potions = index % (table.maxPotions + 1); index /= (table.maxPotions + 1);
+        int enemyHP = index % (table.enemyMaxHP + 1); index /= (table.enemyMaxHP + 1);
+        int playerHP = index;
+        
+        memset(&s, 0, sizeof(s));
+        s.player.maxHP = table.playerMaxHP;
+        s.player.attack = table.playerAttack;
+        s.player.defense = table.playerDefense;
+        s.player.speed = table.playerSpeed;
+        s.player.currentHP = playerHP;
+        s.player.isDefending = playerDefending;
+        s.player.temporaryDefense = playerDefending ? table.playerDefense : 0;
+        
+        s.enemy.maxHP = table.enemyMaxHP;
+        s.enemy.attack = table.enemyAttack;
+        s.enemy.defense = table.enemyDefense;
+        s.enemy.speed = table.enemySpeed;
+        s.enemy.aiType = table.enemyAIType;
+        s.enemy.currentHP = enemyHP;
+        s.enemy.isDefending = enemyDefending;
+        s.enemy.temporaryDefense = enemyDefending ? table.enemyDefense : 0;
+        
+        s.healthPotions = potions;
+        s.combatState = COMBAT_CHOOSE_ACTIONS;
+    }
+    
+    uint32_t encode(const CombatSnapshot& s) const {
+        if (s.combatState == COMBAT_PLAYER_WIN) return STATE_WIN;
+        if (s.combatState == COMBAT_PLAYER_LOSE) return STATE_LOSE;
+        // Stacked defends are folded into the single "defending" flag
+        return CombatPolicy::getIndex(table, s.player.currentHP, s.enemy.currentHP, s.healthPotions,
+                                      s.player.temporaryDefense > 0, s.enemy.temporaryDefense > 0);
+    }
+    
+    double valueOf(uint32_t state) const {
+        if (state == STATE_WIN) return 1.0;
+        if (state == STATE_LOSE) return 0.0;
+        return values[state];
+    }
+    
+    bool isLive(const CombatSnapshot& s) const {
+        return s.player.currentHP > 0 && s.enemy.currentHP > 0;
+    }
+    
+    void build() {
+        stateCount = CombatPolicy::getTableSize(table.playerMaxHP, table.enemyMaxHP, table.maxPotions);
+        values.assign(stateCount, 0.0);
+        successors.assign((size_t)stateCount * 6, STATE_LOSE);
+        attackChance = CombatRules::getEnemyAttackChance((AIType)table.enemyAIType) / 100.0;
+        
+        for (uint32_t i = 0; i < stateCount; i++) {
+            CombatSnapshot start;
+            decode(i, start);
+            if (!isLive(start)) continue;
+            
+            for (int a = 0; a < 3; a++) {
+                for (int e = 0; e < 2; e++) {
+                    CombatSnapshot next = start;
+                    CombatRules::applyTurn(next, (PlayerAction)a, (EnemyAction)e);
+                    successors[(size_t)i * 6 + a * 2 + e] = encode(next);
+                }
+            }
+        }
+    }
+    
+    double actionValue(uint32_t state, int action) const {
+        const uint32_t* next = &successors[(size_t)state * 6 + action * 2];
+        return attackChance * valueOf(next[0]) + (1.0 - attackChance) * valueOf(next[1]);
+    }
+    
+    // Gauss-Seidel value iteration: V(s) = max_a sum_e P(e) V(T(s, a, e))
+    void solve() {
+        iterations = 0;
+        double delta;
+        do {
+            delta = 0.0;
+            for (uint32_t i = 0; i < stateCount; i++) {
+                CombatSnapshot s;
+                decode(i, s);
+                if (!isLive(s)) continue;
+                
+                double best = 0.0;
+                for (int a = 0; a < 3; a++) {
+                    if (a == ACTION_USE_ITEM && s.healthPotions == 0) continue;
+                    double v = actionValue(i, a);
+                    if (v > best) best = v;
+                }
+                double diff = fabs(best - values[i]);
+                if (diff > delta) delta = diff;
+                values[i] = best;
+            }
+            iterations++;
+        } while (delta > 1e-9 && iterations < 10000);
+        
+        // Extract the policy (ties prefer attack, then defend, then potion)
+        entries.assign(stateCount, 0);
+        for (uint32_t i = 0; i < stateCount; i++) {
+            CombatSnapshot s;
+            decode(i, s);
+            int bestAction = ACTION_ATTACK;
+            double best = -1.0;
+            if (isLive(s)) {
+                for (int a = 0; a < 3; a++) {
+                    if (a == ACTION_USE_ITEM && s.healthPotions == 0) continue;
+                    double v = actionValue(i, a);
+                    if (v > best + 1e-12) {
+                        best = v;
+                        bestAction = a;
+                    }
+                }
+            } else {
+                best = (s.enemy.currentHP <= 0 && s.player.currentHP > 0) ? 1.0 : 0.0;
+            }
+            entries[i] = CombatPolicy::packEntry((PlayerAction)bestAction, best);
+        }
+        table.entries = entries.data();
+    }
+};
+
+static void emitHeader(const char* dir, const EnemySpec& enemy, const Solver& solver) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/policy_%s.h", dir, enemy.name);
+    FILE* out = fopen(path, "w");
+    if (!out) {
+        fprintf(stderr, "Cannot write %s\n", path);
+        return;
+    }
+    
+    const CombatPolicyTable& t = solver.table;
+    fprintf(out, "// Generated by tools/policy_solver.cpp - do not edit\n");
+    fprintf(out, "#include \"../combat_policy.h\"\n\n");
+    fprintf(out, "static const uint8_t POLICY_%s_ENTRIES[%u] = {", enemy.name, solver.stateCount);
+    for (uint32_t i = 0; i < solver.stateCount; i++) {
+        fprintf(out, "%s%u,", (i % 24 == 0) ? "\n    " : "", solver.entries[i]);
+    }
+    fprintf(out, "\n};\n\n");
+    fprintf(out, "static const CombatPolicyTable POLICY_%s = {\n", enemy.name);
+    fprintf(out, "    %d, %d, %d, %d,\n", t.playerMaxHP, t.playerAttack, t.playerDefense, t.playerSpeed);
+    fprintf(out, "    %d, %d, %d, %d,\n", t.enemyMaxHP, t.enemyAttack, t.enemyDefense, t.enemySpeed);
+    fprintf(out, "    %d, %d,\n", t.enemyAIType, t.maxPotions);
+    fprintf(out, "    POLICY_%s_ENTRIES\n};\n", enemy.name);
+    fclose(out);
+    printf("  wrote %s\n", path);
+}
+
+int main(int argc, char** argv) {
+    PlayerSpec player = {PLAYER_START_HP, PLAYER_START_ATK, PLAYER_START_DEF, PLAYER_START_SPD, STARTING_POTIONS};
+    const char* emitDir = nullptr;
+    
+    int positional = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--emit") == 0 && i + 1 < argc) {
+            emitDir = argv[++i];
+        } else {
+            int v = atoi(argv[i]);
+            switch (positional++) {
+                case 0: player.hp = v; break;
+                case 1: player.atk = v; break;
+                case 2: player.def = v; break;
+                case 3: player.spd = v; break;
+                case 4: player.potions = v; break;
+            }
+        }
+    }
+    
+    int maxPotions = player.potions < POLICY_MAX_POTIONS ? player.potions : POLICY_MAX_POTIONS;
+    printf("Player build: HP %d ATK %d DEF %d SPD %d, potions %d (table cap %d)\n",
+           player.hp, player.atk, player.def, player.spd, player.potions, maxPotions);
+    
+    for (const EnemySpec& enemy : ENEMIES) {
+        Solver solver;
+        solver.table = {(int16_t)player.hp, (int16_t)player.atk, (int16_t)player.def, (int16_t)player.spd,
+                        (int16_t)enemy.hp, (int16_t)enemy.atk, (int16_t)enemy.def, (int16_t)enemy.spd,
+                        (uint8_t)enemy.ai, (uint8_t)maxPotions, nullptr};
+        solver.build();
+        solver.solve();
+        
+        uint32_t start = CombatPolicy::getIndex(solver.table, player.hp, enemy.hp, maxPotions, false, false);
+        int counts[3] = {0, 0, 0};
+        for (uint32_t i = 0; i < solver.stateCount; i++) {
+            counts[CombatPolicy::unpackAction(solver.entries[i])]++;
+        }
+        
+        printf("%-9s states %6u  table %6u bytes  iterations %4d  win %.4f  opening %s\n",
+               enemy.name, solver.stateCount, solver.stateCount, solver.iterations,
+               solver.values[start],
+               CombatPolicy::unpackAction(solver.entries[start]) == ACTION_ATTACK ? "ATTACK" :
+               CombatPolicy::unpackAction(solver.entries[start]) == ACTION_DEFEND ? "DEFEND" : "ITEM");
+        printf("          policy mix: attack %d, defend %d, item %d\n", counts[0], counts[1], counts[2]);
+        
+        if (emitDir) {
+            emitHeader(emitDir, enemy, solver);
+        }
+    }
+    return 0;
+}
+
+#endif
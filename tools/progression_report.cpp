@@ -0,0 +1,129 @@
+// Host tool: projects hero progression per floor from the PlayerLevels and
+// EnemyCurves tables. XP per floor is the average over generated floors of
+// a random route through the rooms plus the boss; the hero's level and
+// stats follow from the running total. Each floor's boss is then fought by
+// that hero and by a level 1 hero to show how much the levels are worth.
+//
+// Build (from the repo root):
+//   g++ -O2 -std=c++11 -I. tools/progression_report.cpp entities/player_levels.cpp entities/enemy_curves.cpp dungeon/floor_graph.cpp entities/enemy_archetypes.cpp combat/combat_lanes.cpp combat/combat_rules.cpp utils/name_tables.cpp utils/rng.cpp -o progression_report
+// Usage:
+//   ./progression_report [floors sampled per depth] [fights per cell]
+
+#ifndef ARDUINO
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "entities/player_levels.h"
+#include "entities/enemy_curves.h"
+#include "entities/enemy_archetypes.h"
+#include "dungeon/floor_graph.h"
+#include "combat/combat_lanes.h"
+#include "combat/combat_rules.h"
+#include "utils/constants.h"
+#include "utils/rng.h"
+
+static FighterStats heroAtLevel(int level) {
+    const LevelStats& growth = PlayerLevels::getStats(level);
+    FighterStats hero = {PLAYER_START_HP + growth.hp, PLAYER_START_ATK + growth.attack,
+                         PLAYER_START_DEF + growth.defense, PLAYER_START_SPD + growth.speed};
+    return hero;
+}
+
+static int levelForExperience(uint32_t experience) {
+    int level = 1;
+    while (level < MAX_PLAYER_LEVEL && experience >= PlayerLevels::getExperienceFor(level + 1)) {
+        level++;
+    }
+    return level;
+}
+
+// XP from one random route: a door off the entrance, then a random door
+// per room until the boss
+static int routeExperience(const FloorGraph& graph, int floorNumber, Rng& rng, int& fights) {
+    int experience = 0;
+    int node = graph.entry[rng.nextBounded(graph.entryCount)];
+    while (true) {
+        uint32_t packed = graph.nodes[node];
+        int type = FloorGraphGen::getType(packed);
+        if (type == NODE_ENEMY || type == NODE_BOSS) {
+            experience += EnemyCurves::getStats(FloorGraphGen::getEnemyID(packed), floorNumber).experience;
+            fights++;
+        }
+        if (node == FLOOR_BOSS_NODE) break;
+        node = FloorGraphGen::getSuccessor(graph, node, rng.nextBounded(FloorGraphGen::getOutDegree(graph, node)));
+    }
+    return experience;
+}
+
+static double bossWinRate(std::vector<CombatSnapshot>& batch, const FighterStats& hero, int floorNumber, uint32_t& seed) {
+    const LanePolicy policy = {LANE_POTION_THRESHOLD_HP};
+    int fights = (int)batch.size();
+    const EnemyStatBlock& stats = EnemyCurves::getStats(ENEMY_ID_BOSS, floorNumber);
+    FighterStats boss = {stats.hp, stats.attack, stats.defense, stats.speed};
+    AIType ai = (AIType)ENEMY_ARCHETYPES[ENEMY_ID_BOSS].aiType;
+    for (int i = 0; i < fights; i++) {
+        CombatRules::beginFight(batch[i], hero, boss, ai, STARTING_POTIONS, seed++);
+    }
+    CombatLanes::runBatch(batch.data(), fights, policy);
+
+    int wins = 0;
+    for (int i = 0; i < fights; i++) {
+        if (batch[i].combatState == COMBAT_PLAYER_WIN) wins++;
+    }
+    return 100.0 * wins / fights;
+}
+
+int main(int argc, char** argv) {
+    int samples = (argc > 1) ? atoi(argv[1]) : 20000;
+    int fights = (argc > 2) ? atoi(argv[2]) : 2000;
+    if (samples < 1) samples = 1;
+    if (fights < 1) fights = 1;
+
+    // Level curve
+    printf("Level curve (total XP, stats at level)\n");
+    printf("level      xp   HP ATK DEF SPD\n");
+    for (int level = 1; level <= MAX_PLAYER_LEVEL; level++) {
+        FighterStats hero = heroAtLevel(level);
+        printf("%5d %7u %4d %3d %3d %3d\n", level, PlayerLevels::getExperienceFor(level),
+               hero.hp, hero.attack, hero.defense, hero.speed);
+    }
+
+    // Projection per floor
+    printf("\nProjected hero per floor (%d floors sampled per depth, %d boss fights per cell)\n", samples, fights);
+    printf("floor fights  xp/floor  total xp level   HP ATK DEF SPD  boss win (leveled / level 1)\n");
+
+    FloorGraph graph;
+    Rng rng(12345);
+    std::vector<CombatSnapshot> batch(fights);
+    uint32_t fightSeed = 1;
+    double totalExperience = 0;
+
+    for (int floor = 1; floor <= DIFFICULTY_FLOORS; floor++) {
+        long experience = 0;
+        long fightCount = 0;
+        for (int i = 0; i < samples; i++) {
+            int routeFights = 0;
+            FloorGraphGen::generate(graph, floor, rng.next());
+            experience += routeExperience(graph, floor, rng, routeFights);
+            fightCount += routeFights;
+        }
+        double floorExperience = (double)experience / samples;
+
+        // Boss fights use the level the hero entered the floor with
+        int level = levelForExperience((uint32_t)totalExperience);
+        FighterStats hero = heroAtLevel(level);
+        double leveledWins = bossWinRate(batch, hero, floor, fightSeed);
+        double freshWins = bossWinRate(batch, heroAtLevel(1), floor, fightSeed);
+        totalExperience += floorExperience;
+
+        printf("%5d %6.2f %9.1f %9.0f %5d %4d %3d %3d %3d  %6.1f%% / %6.1f%%\n", floor,
+               (double)fightCount / samples, floorExperience, totalExperience, level,
+               hero.hp, hero.attack, hero.defense, hero.speed, leveledWins, freshWins);
+    }
+
+    return 0;
+}
+
+#endif
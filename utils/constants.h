@@ -93,6 +93,10 @@
 #define HEALTH_POTION_COST  25
 #define MIN_DAMAGE          1
 
+// Treasure rooms
+#define MAX_TREASURE_DROPS      3   // Loot rolls per room (room treasure type 1-3)
+#define TREASURE_GOLD_PER_VALUE 5   // Gold found = treasure value * this
+
 // Enemy stats - Goblin (fast, weak)
 #define GOBLIN_HP           25
 #define GOBLIN_ATK          8
@@ -145,6 +149,7 @@
 // Memory management
 #define MAX_COMBAT_LOG_ENTRIES  10
 #define MAX_INVENTORY_SLOTS     15
+#define MAX_ACTIVE_EFFECTS      4
 
 // Version info
 #define GAME_VERSION        "0.1.0"
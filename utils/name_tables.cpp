@@ -0,0 +1,73 @@
+#include "name_tables.h"
+
+// Room text (RoomType order: enemy, treasure, shop, boss)
+static constexpr const char* ROOM_NAMES[] = {
+    "Combat Room",
+    "Treasure Room",
+    "Shop",
+    "Boss Chamber"
+};
+
+static constexpr const char* ROOM_DESCRIPTIONS[] = {
+    "Growling echoes within",
+    "Something glints inside",
+    "You smell incense",
+    "Ominous presence lurks"
+};
+
+// Door icons (DoorIcon order: sword, question, skull)
+static constexpr const char* DOOR_ICON_TEXT[] = {
+    "[!]",
+    "[?]",
+    "[X]"
+};
+
+// Entity names (indexed by name ID - enemy type IDs first, then heroes)
+static constexpr const char* ENTITY_NAMES[NAME_ID_COUNT] = {
+    "Unknown Enemy",
+    "Goblin",
+    "Skeleton",
+    "Orc Warrior",
+    "Adventurer",
+    "Hero"
+};
+
+// Enemy sprites (indexed by enemy type ID)
+static constexpr const char* ENEMY_SPRITES[ENEMY_ID_COUNT] = {
+    "enemies/default.bmp",
+    "enemies/goblin.bmp",
+    "enemies/skeleton.bmp",
+    "enemies/orc.bmp"
+};
+
+#define TABLE_SIZE(table) ((int)(sizeof(table) / sizeof((table)[0])))
+
+const char* NameTables::getRoomName(int roomType) {
+    if (roomType < 0 || roomType >= TABLE_SIZE(ROOM_NAMES)) return "Unknown Room";
+    return ROOM_NAMES[roomType];
+}
+
+const char* NameTables::getRoomDescription(int roomType) {
+    if (roomType < 0 || roomType >= TABLE_SIZE(ROOM_DESCRIPTIONS)) return "Mysterious room";
+    return ROOM_DESCRIPTIONS[roomType];
+}
+
+const char* NameTables::getDoorIconText(int doorIcon) {
+    if (doorIcon < 0 || doorIcon >= TABLE_SIZE(DOOR_ICON_TEXT)) return "[*]";
+    return DOOR_ICON_TEXT[doorIcon];
+}
+
+const char* NameTables::getEntityName(int nameID) {
+    if (nameID < 0 || nameID >= NAME_ID_COUNT) return ENTITY_NAMES[ENEMY_ID_UNKNOWN];
+    return ENTITY_NAMES[nameID];
+}
+
+const char* NameTables::getEnemyName(int enemyID) {
+    if (enemyID < 0 || enemyID >= ENEMY_ID_COUNT) return ENTITY_NAMES[ENEMY_ID_UNKNOWN];
+    return ENTITY_NAMES[enemyID];
+}
+
+const char* NameTables::getEnemySprite(int enemyID) {
+    if (enemyID < 0 || enemyID >= ENEMY_ID_COUNT) return ENEMY_SPRITES[ENEMY_ID_UNKNOWN];
+    return ENEMY_SPRITES[enemyID];
+}
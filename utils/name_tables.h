@@ -0,0 +1,40 @@
+#ifndef NAME_TABLES_H
+#define NAME_TABLES_H
+
+#include <stdint.h>
+
+// Enemy type IDs (same numbering as Room::setEnemyType)
+static const uint8_t ENEMY_ID_UNKNOWN = 0;
+static const uint8_t ENEMY_ID_GOBLIN = 1;
+static const uint8_t ENEMY_ID_SKELETON = 2;
+static const uint8_t ENEMY_ID_ORC = 3;
+static const uint8_t ENEMY_ID_COUNT = 4;
+
+// Entity name IDs: enemy type IDs come first (an enemy's name ID is its
+// type ID), then the hero names
+static const uint8_t NAME_ID_ADVENTURER = ENEMY_ID_COUNT;
+static const uint8_t NAME_ID_HERO = ENEMY_ID_COUNT + 1;
+static const uint8_t NAME_ID_COUNT = ENEMY_ID_COUNT + 2;
+
+// Display text for rooms, doors and enemies, looked up by small integer IDs.
+// The tables are constexpr arrays of string literals, so the text stays in
+// flash and callers get a const char* - no String, no heap.
+// Out-of-range IDs return a fallback entry instead of failing.
+class NameTables {
+public:
+    // Keyed by RoomType
+    static const char* getRoomName(int roomType);
+    static const char* getRoomDescription(int roomType);
+    
+    // Keyed by DoorIcon
+    static const char* getDoorIconText(int doorIcon);
+    
+    // Keyed by entity name ID (enemy type IDs included)
+    static const char* getEntityName(int nameID);
+    
+    // Keyed by enemy type ID
+    static const char* getEnemyName(int enemyID);
+    static const char* getEnemySprite(int enemyID);
+};
+
+#endif
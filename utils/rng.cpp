@@ -0,0 +1,103 @@
+#include "rng.h"
+
+// Default run seed until GameStateManager picks a real one
+static const uint32_t DEFAULT_RUN_SEED = 0x2545F491;
+
+Rng RngService::streams[RNG_STREAM_COUNT];
+uint32_t RngService::runSeed = DEFAULT_RUN_SEED;
+
+// splitmix32 step - spreads a single seed over the whole state
+static uint32_t splitMix32(uint32_t& x) {
+    uint32_t z = (x += 0x9E3779B9);
+    z = (z ^ (z >> 16)) * 0x85EBCA6B;
+    z = (z ^ (z >> 13)) * 0xC2B2AE35;
+    return z ^ (z >> 16);
+}
+
+// Constructors
+Rng::Rng() {
+    seed(DEFAULT_RUN_SEED);
+}
+
+Rng::Rng(uint32_t seedValue) {
+    seed(seedValue);
+}
+
+void Rng::seed(uint32_t seedValue) {
+    uint32_t x = seedValue;
+    for (int i = 0; i < 4; i++) {
+        state[i] = splitMix32(x);
+    }
+    
+    // All-zero state would get stuck at zero forever
+    if ((state[0] | state[1] | state[2] | state[3]) == 0) {
+        state[0] = 1;
+    }
+}
+
+uint32_t Rng::nextBounded(uint32_t bound) {
+    if (bound == 0) return 0;
+    
+    uint64_t m = (uint64_t)next() * bound;
+    uint32_t low = (uint32_t)m;
+    
+    // Reject the few values that would make small results more likely
+    if (low < bound) {
+        uint32_t threshold = (0u - bound) % bound;
+        while (low < threshold) {
+            m = (uint64_t)next() * bound;
+            low = (uint32_t)m;
+        }
+    }
+    
+    return (uint32_t)(m >> 32);
+}
+
+int Rng::range(int minValue, int maxValue) {
+    if (maxValue <= minValue) return minValue;
+    return minValue + (int)nextBounded((uint32_t)(maxValue - minValue));
+}
+
+bool Rng::chance(int percent) {
+    return range(0, 100) < percent;
+}
+
+void Rng::getState(uint32_t out[4]) const {
+    for (int i = 0; i < 4; i++) {
+        out[i] = state[i];
+    }
+}
+
+void Rng::setState(const uint32_t in[4]) {
+    for (int i = 0; i < 4; i++) {
+        state[i] = in[i];
+    }
+}
+
+// ==============================================
+// RNG SERVICE
+// ==============================================
+
+void RngService::seedRun(uint32_t seed) {
+    runSeed = seed;
+    for (int i = 0; i < RNG_STREAM_COUNT; i++) {
+        streams[i].seed(deriveSeed(seed, i + 1));
+    }
+}
+
+uint32_t RngService::getRunSeed() {
+    return runSeed;
+}
+
+Rng& RngService::get(RngStream stream) {
+    if (stream < 0 || stream >= RNG_STREAM_COUNT) {
+        stream = RNG_DUNGEON;
+    }
+    return streams[stream];
+}
+
+uint32_t RngService::deriveSeed(uint32_t seed, uint32_t salt) {
+    uint32_t x = seed ^ (salt * 0x9E3779B9);
+    splitMix32(x);
+    return splitMix32(x);
+}
@@ -0,0 +1,79 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+// Independent random streams, all derived from a single run seed
+enum RngStream {
+    RNG_DUNGEON = 0,   // Floor layout and room contents
+    RNG_LOOT = 1,      // Treasure rolls
+    RNG_COMBAT = 2,    // Enemy AI decisions
+    RNG_STREAM_COUNT = 3
+};
+
+// Small, fast xoshiro128** generator.
+// Only 32-bit operations, so it runs the same on the ESP32 and on a host PC.
+class Rng {
+private:
+    uint32_t state[4];
+    
+    static uint32_t rotl(uint32_t x, int k) {
+        return (x << k) | (x >> (32 - k));
+    }
+    
+public:
+    // Constructors
+    Rng();
+    Rng(uint32_t seedValue);
+    
+    // Seeding
+    void seed(uint32_t seedValue);
+    
+    // Raw 32-bit output
+    uint32_t next() {
+        uint32_t result = rotl(state[1] * 5, 7) * 9;
+        uint32_t t = state[1] << 9;
+        
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 11);
+        
+        return result;
+    }
+    
+    // Unbiased integer in [0, bound) (Lemire's multiply-and-reject method)
+    uint32_t nextBounded(uint32_t bound);
+    
+    // Integer in [minValue, maxValue) - same contract as Arduino random(min, max)
+    int range(int minValue, int maxValue);
+    
+    // True with the given percent chance (0-100)
+    bool chance(int percent);
+    
+    // Raw state access (for combat snapshots and replays)
+    void getState(uint32_t out[4]) const;
+    void setState(const uint32_t in[4]);
+};
+
+// Global access to the per-run random streams
+class RngService {
+private:
+    static Rng streams[RNG_STREAM_COUNT];
+    static uint32_t runSeed;
+    
+public:
+    // Reseed every stream from one run seed
+    static void seedRun(uint32_t seed);
+    static uint32_t getRunSeed();
+    
+    // Stream access
+    static Rng& get(RngStream stream);
+    
+    // Mix a seed with a salt (stream id, floor number...) into a new seed
+    static uint32_t deriveSeed(uint32_t seed, uint32_t salt);
+};
+
+#endif